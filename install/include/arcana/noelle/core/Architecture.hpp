@@ -0,0 +1,97 @@
+/*
+ * Copyright 2016 - 2021  Angelo Matni, Simone Campanoni
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifndef NOELLE_SRC_CORE_ARCHITECTURE_H_
+#define NOELLE_SRC_CORE_ARCHITECTURE_H_
+
+#include <mutex>
+#include "arcana/noelle/core/SystemHeaders.hpp"
+
+namespace arcana::noelle {
+
+class Architecture {
+public:
+  Architecture();
+
+  /*
+   * Set the directory that plays the role of /sys when reading the topology
+   * of the machine (e.g., a fake sysfs tree used for testing).
+   * This must be invoked before any other query.
+   */
+  static void setSystemRoot(std::string root);
+
+  static uint32_t getNumberOfLogicalCores(void);
+
+  static uint32_t getNumberOfPhysicalCores(void);
+
+  /*
+   * Return the number of logical cores that share a physical core (SMT).
+   */
+  static uint32_t getNumberOfLogicalCoresPerPhysicalCore(void);
+
+  static uint32_t getNumberOfNUMANodes(void);
+
+  static uint32_t getNUMANodeOfLogicalCore(uint32_t logicalCore);
+
+  static std::vector<uint32_t> getLogicalCoresOfNUMANode(uint32_t node);
+
+  /*
+   * Caches are numbered from 1 (L1).
+   * Only data and unified caches are considered.
+   * getCacheBytes returns 0 if the cache level is unknown.
+   */
+  static uint32_t getNumberOfCacheLevels(void);
+
+  static uint64_t getCacheBytes(uint32_t level);
+
+  static int32_t getCacheLineBytes(void);
+
+private:
+  struct Topology {
+    uint32_t logicalCores;
+    uint32_t physicalCores;
+    uint32_t logicalCoresPerPhysicalCore;
+    std::map<uint32_t, uint32_t> numaNodeOfCore;
+    std::map<uint32_t, std::vector<uint32_t>> coresOfNUMANode;
+    std::map<uint32_t, uint64_t> cacheBytes;
+    int32_t cacheLineBytes;
+  };
+
+  static std::string systemRoot;
+  static std::unique_ptr<Topology> topology;
+  static std::mutex topologyLock;
+
+  static const Topology &getTopology(void);
+
+  static std::unique_ptr<Topology> readTopology(void);
+
+  static std::optional<std::string> readFile(std::string fileName);
+
+  static std::optional<uint64_t> readNumber(std::string fileName);
+
+  static std::vector<uint32_t> parseListOfCores(std::string list);
+
+  static uint64_t parseSize(std::string size);
+};
+
+} // namespace arcana::noelle
+
+#endif // NOELLE_SRC_CORE_ARCHITECTURE_H_
@@ -0,0 +1,90 @@
+#ifndef NOELLE_SRC_CORE_BASIC_UTILITIES_BITMATRIX_H_
+#define NOELLE_SRC_CORE_BASIC_UTILITIES_BITMATRIX_H_
+
+#include "arcana/noelle/core/SystemHeaders.hpp"
+
+using namespace llvm;
+
+namespace llvm {
+
+// BitMatrix is a NxN bit-matrix that depicts whether a relation R
+// holds for a pair with indices (i,j) (i.e., R(i,j) = 0/1)
+// BitMatrix is intended for a dense, asymmetric relation R.
+// Every row is stored in its own sequence of 64-bit words, so that operations
+// on whole rows (e.g., unionRows) work on 64 columns at a time.
+struct BitMatrix {
+  BitMatrix(uint32_t n = 1)
+    : N(n),
+      wordsPerRow(numberOfWords(n)),
+      words(static_cast<uint64_t>(n) * numberOfWords(n), 0) {}
+
+  // Returns the number of pairs (i,j) that are related
+  uint32_t count() const;
+
+  // Specifies that row is related to col, i.e., R(row,col) = 1
+  void set(uint32_t row, uint32_t col, bool v = true);
+
+  // Checks whether row is related to col,
+  // i.e., R(row,col) == 1 (R is not symmetric)
+  bool test(uint32_t row, uint32_t col) const;
+
+  // Resizes matrix to nxn
+  void resize(uint32_t n);
+
+  // Enlarges matrix to nxn (n >= N) keeping the relations already set
+  void grow(uint32_t n);
+
+  // Returns N
+  uint32_t size() const;
+
+  // Specifies that row is not related to any col
+  void resetRow(uint32_t row);
+
+  // Relates row to every col otherRow is related to,
+  // i.e., row[i] |= otherRow[i]
+  // Returns true if row changed
+  bool unionRows(uint32_t row, uint32_t otherRow);
+
+  // Computes the transitive closure.
+  // For example, given a adjacency matrix, it converts it to a connectivity
+  // matrix, where (i,j) is set if there is a directed path from i to j
+  void transitiveClosure();
+
+  // Computes the transitive closure of an acyclic relation.
+  // order must include every row after all the rows it is related to (i.e.,
+  // a reverse topological order). Every row is then computed only once by
+  // merging the (already closed) rows it is related to.
+  void transitiveClosure(const std::vector<uint32_t> &order);
+
+  // Emits to fout the BitMatrix
+  void dump(raw_ostream &fout) const;
+
+private:
+  uint32_t N;
+  uint32_t wordsPerRow;
+  std::vector<uint64_t> words;
+
+  // Returns the number of 64-bit words needed to store n bits
+  static uint32_t numberOfWords(uint32_t n) {
+    return (n + 63) / 64;
+  }
+
+  // For a given row returns the first col that is set.
+  // Returns -1 if none found.
+  int32_t firstSuccessor(uint32_t row) const;
+
+  // For a given row returns the first col after prev (col>prev) that is set.
+  // Returns -1 if none found.
+  int32_t nextSuccessor(uint32_t row, uint32_t prev) const;
+
+  // For a given row returns the first col at or after col that is set.
+  // Returns -1 if none found.
+  int32_t findFrom(uint32_t row, uint32_t col) const;
+
+  // Returns the index of the first word of row
+  uint64_t rowBegin(uint32_t row) const;
+};
+
+} // namespace llvm
+
+#endif // NOELLE_SRC_CORE_BASIC_UTILITIES_BITMATRIX_H_
@@ -0,0 +1,110 @@
+/*
+ * Copyright 2024  Simone Campanoni
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifndef NOELLE_SRC_CORE_DATAFLOW_BITVECTORDATAFLOWRESULT_H_
+#define NOELLE_SRC_CORE_DATAFLOW_BITVECTORDATAFLOWRESULT_H_
+
+#include "arcana/noelle/core/SystemHeaders.hpp"
+
+namespace arcana::noelle {
+
+/*
+ * Result of a data-flow analysis whose sets are subsets of a fixed universe of
+ * values (e.g., the instructions of a function).
+ *
+ * Values of the universe are numbered densely and sets are stored as bit
+ * vectors.
+ * GEN and KILL are kept per instruction as lists of value IDs, while IN and OUT
+ * are computed per basic block only.
+ * The IN and OUT sets of an instruction are derived on demand from the ones of
+ * its basic block, the first time they are requested.
+ */
+class BitVectorDataFlowResult {
+public:
+  BitVectorDataFlowResult(Function *f,
+                          std::vector<Value *> const &universe,
+                          bool isForward);
+
+  BitVectorDataFlowResult() = delete;
+
+  Function *getFunction(void) const;
+
+  bool isForward(void) const;
+
+  /*
+   * Universe of the values.
+   */
+  uint32_t getNumberOfValues(void) const;
+  bool isInUniverse(Value *v) const;
+  uint32_t getValueID(Value *v) const;
+  Value *getValue(uint32_t valueID) const;
+
+  /*
+   * GEN and KILL of an instruction.
+   */
+  void addToGEN(Instruction *inst, Value *v);
+  void addToKILL(Instruction *inst, Value *v);
+  ArrayRef<uint32_t> GEN(Instruction *inst) const;
+  ArrayRef<uint32_t> KILL(Instruction *inst) const;
+
+  /*
+   * IN and OUT of a basic block (i.e., of its first and last instructions for
+   * a forward analysis and vice versa for a backward one).
+   */
+  BitVector &IN(BasicBlock *bb);
+  BitVector &OUT(BasicBlock *bb);
+
+  /*
+   * IN and OUT of an instruction.
+   * They are valid only once the analysis has reached its fixed point.
+   */
+  const BitVector &IN(Instruction *inst);
+  const BitVector &OUT(Instruction *inst);
+
+  /*
+   * Apply the transfer function of @inst to @set.
+   */
+  void applyTransferFunction(Instruction *inst, BitVector &set) const;
+
+  /*
+   * Convert @set to the values it contains.
+   */
+  std::set<Value *> toSet(const BitVector &set) const;
+
+private:
+  Function *f;
+  bool forward;
+  std::vector<Value *> values;
+  DenseMap<Value *, uint32_t> valueIDs;
+  DenseMap<Instruction *, SmallVector<uint32_t, 1>> gens;
+  DenseMap<Instruction *, SmallVector<uint32_t, 1>> kills;
+  DenseMap<BasicBlock *, BitVector> blockINs;
+  DenseMap<BasicBlock *, BitVector> blockOUTs;
+  std::unordered_map<Instruction *, BitVector> ins;
+  std::unordered_map<Instruction *, BitVector> outs;
+  std::unordered_set<BasicBlock *> blocksWithInstructionSets;
+
+  void computeInstructionSets(BasicBlock *bb);
+};
+
+} // namespace arcana::noelle
+
+#endif // NOELLE_SRC_CORE_DATAFLOW_BITVECTORDATAFLOWRESULT_H_
@@ -0,0 +1,73 @@
+/*
+ * Copyright 2024  Simone Campanoni
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifndef NOELLE_SRC_CORE_CFG_ANALYSIS_CFGREACHABILITY_H_
+#define NOELLE_SRC_CORE_CFG_ANALYSIS_CFGREACHABILITY_H_
+
+#include "arcana/noelle/core/SystemHeaders.hpp"
+
+namespace arcana::noelle {
+
+/*
+ * Reachability between the basic blocks (and the instructions) of a function.
+ *
+ * If a loop header is given, the edges that jump to it are ignored. This
+ * limits the reachability to a single iteration of that loop.
+ *
+ * The basic blocks are condensed into the DAG of their strongly connected
+ * components when the object is created. The components reachable from a
+ * given one are computed the first time a query needs them, and they are
+ * reused by the queries that follow.
+ */
+class CFGReachability {
+public:
+  CFGReachability(Function &f, BasicBlock *header);
+
+  CFGReachability() = delete;
+
+  /*
+   * Check if there is a non-empty path from @from to @to.
+   */
+  bool canReach(BasicBlock *from, BasicBlock *to);
+
+  /*
+   * Check if @to can be executed after @from.
+   */
+  bool canReach(Instruction *from, Instruction *to);
+
+private:
+  BasicBlock *header;
+  DenseMap<BasicBlock *, uint32_t> componentOf;
+  std::vector<bool> isCyclic;
+  std::vector<std::vector<uint32_t>> componentSuccessors;
+  std::vector<BitVector> reachableComponents;
+  std::vector<bool> isReachabilityComputed;
+
+  bool isEdgeIncluded(BasicBlock *to) const;
+
+  void computeComponents(Function &f);
+
+  const BitVector &getReachableComponents(uint32_t component);
+};
+
+} // namespace arcana::noelle
+
+#endif // NOELLE_SRC_CORE_CFG_ANALYSIS_CFGREACHABILITY_H_
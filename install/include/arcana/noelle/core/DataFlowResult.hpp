@@ -0,0 +1,68 @@
+/*
+ * Copyright 2016 - 2023  Angelo Matni, Simone Campanoni
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifndef NOELLE_SRC_CORE_DATAFLOW_DATAFLOWRESULT_H_
+#define NOELLE_SRC_CORE_DATAFLOW_DATAFLOWRESULT_H_
+
+#include "arcana/noelle/core/SystemHeaders.hpp"
+#include "arcana/noelle/core/BitVectorDataFlowResult.hpp"
+
+namespace arcana::noelle {
+
+class DataFlowResult {
+public:
+  /*
+   * Methods
+   */
+  DataFlowResult();
+
+  /*
+   * Adapter of @bitVectorResult, which is now owned by "this".
+   * The sets of an instruction are materialized the first time they are
+   * requested.
+   */
+  DataFlowResult(BitVectorDataFlowResult *bitVectorResult);
+
+  DataFlowResult(const DataFlowResult &) = delete;
+
+  std::set<Value *> &GEN(Instruction *inst);
+  std::set<Value *> &KILL(Instruction *inst);
+  std::set<Value *> &IN(Instruction *inst);
+  std::set<Value *> &OUT(Instruction *inst);
+
+  /*
+   * Return the bit-vector result "this" is an adapter of, if any.
+   */
+  BitVectorDataFlowResult *getBitVectorResult(void) const;
+
+  ~DataFlowResult();
+
+private:
+  std::map<Instruction *, std::set<Value *>> gens;
+  std::map<Instruction *, std::set<Value *>> kills;
+  std::map<Instruction *, std::set<Value *>> ins;
+  std::map<Instruction *, std::set<Value *>> outs;
+  BitVectorDataFlowResult *bitVectorResult;
+};
+
+} // namespace arcana::noelle
+
+#endif // NOELLE_SRC_CORE_DATAFLOW_DATAFLOWRESULT_H_
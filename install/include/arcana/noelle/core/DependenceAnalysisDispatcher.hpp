@@ -0,0 +1,168 @@
+/*
+ * Copyright 2024  Simone Campanoni
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifndef NOELLE_SRC_CORE_DEPENDENCE_ANALYSIS_DEPENDENCE_ANALYSIS_DISPATCHER_H_
+#define NOELLE_SRC_CORE_DEPENDENCE_ANALYSIS_DEPENDENCE_ANALYSIS_DISPATCHER_H_
+
+#include "arcana/noelle/core/SystemHeaders.hpp"
+#include "arcana/noelle/core/DependenceAnalysis.hpp"
+
+namespace arcana::noelle {
+
+/*
+ * Statistics about the queries sent to a dependence analysis.
+ */
+struct DependenceAnalysisProfile {
+  std::string name;
+
+  /*
+   * Number of queries answered by invoking the analysis.
+   */
+  uint64_t queries = 0;
+
+  /*
+   * Number of queries answered by a verdict of the analysis that was cached.
+   */
+  uint64_t cachedQueries = 0;
+
+  /*
+   * Number of queries (invoked or cached) for which the analysis proved that
+   * the dependence (or its loop-carried property) does not exist.
+   */
+  uint64_t independences = 0;
+
+  /*
+   * Time spent in the analysis.
+   */
+  double seconds = 0;
+};
+
+/*
+ * Dispatcher of the queries about dependences to the dependence analyses it
+ * includes.
+ *
+ * Analyses are invoked in the order they have been added (rather than in the
+ * order of their addresses), until one of them proves the lack of the
+ * dependence. The verdicts do not depend on this order; only the number of
+ * queries each analysis receives does.
+ * The verdicts about loops of intraprocedural analyses (see
+ * DependenceAnalysis::isIntraprocedural) are cached: rebuilding the
+ * dependence graph of a loop does not invoke them again. The verdicts about
+ * a function are dropped when its instructions change (see refreshCache).
+ * Verdicts of the other analyses and verdicts that involve a call are never
+ * cached, as they depend on other functions too.
+ */
+class DependenceAnalysisDispatcher {
+public:
+  DependenceAnalysisDispatcher();
+
+  void addAnalysis(DependenceAnalysis *a);
+
+  bool isEmpty(void) const;
+
+  /*
+   * Check if none of the analyses can prove the lack of the memory data
+   * dependence from @fromInst to @toInst.
+   */
+  bool canThereBeAMemoryDataDependence(Instruction *fromInst,
+                                       Instruction *toInst,
+                                       Function &function);
+
+  bool canThereBeAMemoryDataDependence(Instruction *fromInst,
+                                       Instruction *toInst,
+                                       LoopStructure &loop);
+
+  /*
+   * Return CANNOT_EXIST if any analysis proves the lack of the dependence,
+   * MUST_EXIST if any analysis proves its existence, and MAY_EXIST otherwise.
+   */
+  MemoryDataDependenceStrength isThereThisMemoryDataDependenceType(
+      DataDependenceType t,
+      Instruction *fromInst,
+      Instruction *toInst,
+      Function &function);
+
+  MemoryDataDependenceStrength isThereThisMemoryDataDependenceType(
+      DataDependenceType t,
+      Instruction *fromInst,
+      Instruction *toInst,
+      LoopStructure &loop);
+
+  /*
+   * Check if none of the analyses can prove that @dep is not loop-carried.
+   */
+  bool canThisDependenceBeLoopCarried(DGEdge<Value, Value> *dep,
+                                      LoopStructure &loop);
+
+  /*
+   * Drop the verdicts about the loops of @f if the instructions of @f changed
+   * since the last invocation.
+   */
+  void refreshCache(Function &f);
+
+  std::vector<DependenceAnalysisProfile> getProfiles(void) const;
+
+private:
+  enum QueryType : uint8_t {
+    MEMORY_DATA_DEPENDENCE,
+    MEMORY_DATA_DEPENDENCE_TYPE,
+    LOOP_CARRIED_DEPENDENCE
+  };
+
+  struct Query {
+    uint32_t analysisID;
+    QueryType type;
+    uint8_t dependence;
+    Instruction *fromInst;
+    Instruction *toInst;
+    BasicBlock *loopHeader;
+
+    bool operator==(const Query &other) const;
+  };
+
+  struct QueryHash {
+    size_t operator()(const Query &q) const;
+  };
+
+  std::vector<DependenceAnalysis *> analyses;
+  std::vector<DependenceAnalysisProfile> profiles;
+  std::unordered_map<Function *,
+                     std::unordered_map<Query, uint8_t, QueryHash>>
+      verdicts;
+  std::unordered_map<Function *, size_t> fingerprints;
+
+  /*
+   * Fetch the verdict of an analysis about @query, invoking @invoke if it
+   * isn't cached.
+   * Only queries about loops that do not involve calls are cached, and only
+   * for intraprocedural analyses: @loopFunction is the function of the loop,
+   * or nullptr for queries about functions.
+   * @independence is the verdict that proves the lack of the dependence.
+   */
+  uint8_t getVerdict(Function *loopFunction,
+                     const Query &query,
+                     std::function<uint8_t(DependenceAnalysis *)> invoke,
+                     uint8_t independence);
+};
+
+} // namespace arcana::noelle
+
+#endif // NOELLE_SRC_CORE_DEPENDENCE_ANALYSIS_DEPENDENCE_ANALYSIS_DISPATCHER_H_
@@ -0,0 +1,87 @@
+/*
+ * Copyright 2024  Simone Campanoni
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifndef NOELLE_SRC_CORE_HOTPROFILER_HOTPROFILECACHE_H_
+#define NOELLE_SRC_CORE_HOTPROFILER_HOTPROFILECACHE_H_
+
+#include "arcana/noelle/core/SystemHeaders.hpp"
+#include "arcana/noelle/core/FunctionSectionsFile.hpp"
+
+namespace arcana::noelle {
+
+/*
+ * Binary file that stores the invocations of the basic blocks of the
+ * functions of a module, so they can be loaded without computing the block
+ * frequencies of the functions that did not change.
+ *
+ * The file is a FunctionSectionsFile without header words.
+ * The section of a function is the number of its basic blocks followed by
+ * their invocations (ULEB128 encoded) in layout order.
+ *
+ * The hash of a function covers both its code and its profile metadata, so
+ * the section of a function is reused only if both are unchanged.
+ */
+class HotProfileCache {
+public:
+  /*
+   * Map @fileName.
+   */
+  HotProfileCache(const std::string &fileName);
+
+  HotProfileCache() = delete;
+
+  /*
+   * Check if the file exists and it is well formed.
+   */
+  bool isValid(void) const;
+
+  /*
+   * Fetch the invocations of the basic blocks of @F stored in the file.
+   * Return false if the file does not store them for @F as it is now.
+   */
+  bool getBasicBlockInvocations(Function &F,
+                                std::vector<uint64_t> &invocations) const;
+
+  /*
+   * Store the invocations of the basic blocks of the functions of @M into
+   * @fileName.
+   * Return true if the file has been written.
+   */
+  static bool write(
+      Module &M,
+      const std::unordered_map<BasicBlock *, uint64_t> &bbInvocations,
+      const std::string &fileName);
+
+  /*
+   * Hash of the code and of the profile metadata of @F.
+   */
+  static uint64_t computeFunctionHash(Function &F);
+
+private:
+  FunctionSectionsFile file;
+
+  static const char magic[8];
+  static const uint32_t version;
+};
+
+} // namespace arcana::noelle
+
+#endif // NOELLE_SRC_CORE_HOTPROFILER_HOTPROFILECACHE_H_
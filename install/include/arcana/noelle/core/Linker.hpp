@@ -0,0 +1,60 @@
+/*
+ * Copyright 2021 - 2023  Simone Campanoni
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifndef NOELLE_SRC_CORE_LINKER_H_
+#define NOELLE_SRC_CORE_LINKER_H_
+
+#include "arcana/noelle/core/SystemHeaders.hpp"
+#include "arcana/noelle/core/TypesManager.hpp"
+#include "arcana/noelle/core/LoopStructure.hpp"
+
+namespace arcana::noelle {
+
+class Linker {
+public:
+  Linker(Module &m, TypesManager *tm);
+
+  void linkTransformedLoopToOriginalFunction(
+      BasicBlock *originalPreHeader,
+      BasicBlock *startOfParLoopInOriginalFunc,
+      BasicBlock *endOfParLoopInOriginalFunc,
+      Value *envArray,
+      Value *envIndexForExitVariable,
+      std::vector<BasicBlock *> &loopExitBlocks,
+      uint32_t minIdleCores);
+
+  void substituteOriginalLoopWithTransformedLoop(
+      LoopStructure *originalLoop,
+      BasicBlock *startOfParLoopInOriginalFunc,
+      BasicBlock *endOfParLoopInOriginalFunc,
+      Value *envArray,
+      Value *envIndexForExitVariable,
+      std::vector<BasicBlock *> &loopExitBlocks,
+      uint32_t minIdleCores);
+
+private:
+  Module &program;
+  TypesManager *tm;
+};
+
+} // namespace arcana::noelle
+
+#endif // NOELLE_SRC_CORE_LINKER_H_
@@ -0,0 +1,198 @@
+/*
+ * Copyright 2016 - 2022  Angelo Matni, Simone Campanoni
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifndef NOELLE_SRC_CORE_LOOP_STRUCTURE_LOOPSTRUCTURE_H_
+#define NOELLE_SRC_CORE_LOOP_STRUCTURE_LOOPSTRUCTURE_H_
+
+#include "arcana/noelle/core/SystemHeaders.hpp"
+
+namespace arcana::noelle {
+
+class LoopStructure {
+public:
+  /*
+   * Iterator over the instructions of a loop.
+   * Instructions are visited basic block by basic block, following the order
+   * of the basic blocks of the loop.
+   */
+  class instruction_iterator {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Instruction *;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Instruction **;
+    using reference = Instruction *;
+
+    instruction_iterator(std::vector<BasicBlock *>::const_iterator bbIt,
+                         std::vector<BasicBlock *>::const_iterator bbEnd)
+      : bbIt{ bbIt },
+        bbEnd{ bbEnd } {
+      this->skipEmptyBasicBlocks();
+      return;
+    }
+
+    Instruction *operator*(void) const {
+      return &*this->instIt;
+    }
+
+    instruction_iterator &operator++(void) {
+      this->instIt++;
+      if (this->instIt == (*this->bbIt)->end()) {
+        this->bbIt++;
+        this->skipEmptyBasicBlocks();
+      }
+      return *this;
+    }
+
+    instruction_iterator operator++(int) {
+      auto old = *this;
+      ++(*this);
+      return old;
+    }
+
+    bool operator==(const instruction_iterator &other) const {
+      if (this->bbIt != other.bbIt) {
+        return false;
+      }
+      if (this->bbIt == this->bbEnd) {
+        return true;
+      }
+      return this->instIt == other.instIt;
+    }
+
+    bool operator!=(const instruction_iterator &other) const {
+      return !(*this == other);
+    }
+
+  private:
+    std::vector<BasicBlock *>::const_iterator bbIt;
+    std::vector<BasicBlock *>::const_iterator bbEnd;
+    BasicBlock::iterator instIt;
+
+    void skipEmptyBasicBlocks(void) {
+      while ((this->bbIt != this->bbEnd) && (*this->bbIt)->empty()) {
+        this->bbIt++;
+      }
+      if (this->bbIt != this->bbEnd) {
+        this->instIt = (*this->bbIt)->begin();
+      }
+      return;
+    }
+  };
+
+  LoopStructure(Loop *l);
+
+  std::optional<uint64_t> getID(void);
+
+  /*
+   * setID() behaves in this way:
+   * if ID doesn't exist in the metadata, then add it
+   * if ID does exist, then reset it to the parameter value
+   */
+  void setID(uint64_t ID);
+
+  bool doesHaveID(void);
+
+  Function *getFunction(void) const;
+
+  BasicBlock *getHeader(void) const;
+
+  BasicBlock *getPreHeader(void) const;
+
+  Instruction *getEntryInstruction(void) const;
+
+  BasicBlock *getSuccessorWithinLoopOfTheHeader(void) const;
+
+  /*
+   * Return the nesting level of the loop.
+   * 1 means outermost loop.
+   */
+  uint32_t getNestingLevel(void) const;
+
+  const std::unordered_set<BasicBlock *> &getLatches(void) const;
+
+  const std::unordered_set<BasicBlock *> &getBasicBlocks(void) const;
+
+  /*
+   * Return a new set with all instructions of the loop.
+   * Use instructions() to iterate over them without building the set.
+   */
+  std::unordered_set<Instruction *> getInstructions(void) const;
+
+  /*
+   * Iterate over the basic blocks (instructions) of the loop without copying
+   * them.
+   * The order is the one of the LLVM loop the current one has been built
+   * from, which is deterministic across runs.
+   */
+  iterator_range<std::vector<BasicBlock *>::const_iterator> blocks(
+      void) const;
+
+  iterator_range<instruction_iterator> instructions(void) const;
+
+  uint64_t getNumberOfInstructions(void) const;
+
+  std::vector<BasicBlock *> getLoopExitBasicBlocks(void) const;
+
+  bool isALoopExit(Instruction *i) const;
+
+  std::vector<std::pair<BasicBlock *, BasicBlock *>> getLoopExitEdges(
+      void) const;
+
+  uint64_t numberOfExitBasicBlocks(void) const;
+
+  bool isLoopInvariant(Value *value) const;
+
+  bool isIncluded(BasicBlock *bb) const;
+
+  bool isIncluded(Instruction *inst) const;
+
+  void print(raw_ostream &stream);
+
+private:
+  BasicBlock *header;
+  BasicBlock *preHeader;
+  uint32_t depth;
+  std::unordered_set<Instruction *> invariants;
+  std::unordered_set<BasicBlock *> latchBBs;
+  std::unordered_set<BasicBlock *> bbs;
+  std::vector<BasicBlock *> orderedBBs;
+
+  /*
+   * Certain parallelization schemes rely on indexing exit blocks, so some
+   * arbitrary order needs to be established The reason that ordering isn't
+   * dictated later is to maintain reproducibility; LLVM returns a vector to
+   * begin with, so losing that ordering and re-establishing it from an
+   * unordered data structure is fraught.
+   */
+  std::vector<BasicBlock *> exitBlocks;
+  std::vector<std::pair<BasicBlock *, BasicBlock *>> exitEdges;
+
+  static const std::string metadataKeyID;
+
+  void instantiateIDsAndBasicBlocks(Loop *llvmLoop);
+
+  bool isContainedInstructionLoopInvariant(Instruction *inst) const;
+};
+
+} // namespace arcana::noelle
+
+#endif // NOELLE_SRC_CORE_LOOP_STRUCTURE_LOOPSTRUCTURE_H_
@@ -0,0 +1,71 @@
+/*
+ * Copyright 2023 - 2024  Simone Campanoni
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifndef NOELLE_SRC_CORE_DG_MEMORY_DEPENDENCE_H_
+#define NOELLE_SRC_CORE_DG_MEMORY_DEPENDENCE_H_
+
+#include "arcana/noelle/core/DataDependence.hpp"
+
+namespace arcana::noelle {
+
+template <class T, class SubT>
+class MemoryDependence : public DataDependence<T, SubT> {
+public:
+  MemoryDependence() = delete;
+
+  static bool classof(const DGEdge<T, SubT> *s);
+
+protected:
+  MemoryDependence(typename DGEdge<T, SubT>::DependenceKind k,
+                   DGNode<T> *src,
+                   DGNode<T> *dst,
+                   DataDependenceType t);
+
+  MemoryDependence(const MemoryDependence<T, SubT> &edgeToCopy);
+};
+
+template <class T, class SubT>
+MemoryDependence<T, SubT>::MemoryDependence(
+    typename DGEdge<T, SubT>::DependenceKind k,
+    DGNode<T> *src,
+    DGNode<T> *dst,
+    DataDependenceType t)
+  : DataDependence<T, SubT>(k, src, dst, t) {
+  return;
+}
+
+template <class T, class SubT>
+MemoryDependence<T, SubT>::MemoryDependence(
+    const MemoryDependence<T, SubT> &edgeToCopy)
+  : DataDependence<T, SubT>(edgeToCopy) {
+  return;
+}
+
+template <class T, class SubT>
+bool MemoryDependence<T, SubT>::classof(const DGEdge<T, SubT> *s) {
+  auto sKind = s->getKind();
+  return (sKind >= DGEdge<T, SubT>::DependenceKind::FIRST_MEMORY_DEPENDENCE)
+         && (sKind <= DGEdge<T, SubT>::DependenceKind::LAST_MEMORY_DEPENDENCE);
+}
+
+} // namespace arcana::noelle
+
+#endif
@@ -0,0 +1,56 @@
+/*
+ * Copyright 2023 - 2024  Simone Campanoni
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifndef NOELLE_SRC_CORE_PDG_TRAITS_H_
+#define NOELLE_SRC_CORE_PDG_TRAITS_H_
+
+#include "arcana/noelle/core/DGGraphTraits.hpp"
+#include "arcana/noelle/core/PDG.hpp"
+
+namespace llvm {
+
+/*
+ * Specializations for GraphTraits and DOTGraphTraits using GraphTraitsBase and
+ * ElementTraits.
+ */
+template <>
+struct DOTGraphTraits<
+    arcana::noelle::DGGraphWrapper<arcana::noelle::PDG, Value> *>
+  : public arcana::noelle::ElementTraits<
+        arcana::noelle::DGGraphWrapper<arcana::noelle::PDG, Value>,
+        arcana::noelle::DGNodeWrapper<Value>,
+        Value> {
+  DOTGraphTraits(bool isSimple = false)
+    : arcana::noelle::ElementTraits<
+        arcana::noelle::DGGraphWrapper<arcana::noelle::PDG, Value>,
+        arcana::noelle::DGNodeWrapper<Value>,
+        Value>(isSimple) {}
+};
+template <>
+struct GraphTraits<arcana::noelle::DGGraphWrapper<arcana::noelle::PDG, Value> *>
+  : public arcana::noelle::GraphTraitsBase<
+        arcana::noelle::DGGraphWrapper<arcana::noelle::PDG, Value>,
+        arcana::noelle::DGNodeWrapper<Value>,
+        Value> {};
+
+} // namespace llvm
+
+#endif
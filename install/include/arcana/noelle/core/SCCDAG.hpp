@@ -0,0 +1,188 @@
+/*
+ * Copyright 2016 - 2023  Angelo Matni, Simone Campanoni
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifndef NOELLE_SRC_CORE_SCCDAG_H_
+#define NOELLE_SRC_CORE_SCCDAG_H_
+
+#include "arcana/noelle/core/SystemHeaders.hpp"
+#include "arcana/noelle/core/BitMatrix.hpp"
+#include "arcana/noelle/core/DGBase.hpp"
+#include "arcana/noelle/core/PDG.hpp"
+#include "arcana/noelle/core/SCC.hpp"
+
+namespace arcana::noelle {
+
+/*
+ * SCCDAG of a dependence graph.
+ */
+class SCCDAG : public DG<SCC> {
+public:
+  /*
+   * Constructor.
+   */
+  SCCDAG(PDG *dependenceGraph);
+
+  /*
+   * Check if @inst is included in the SCCDAG.
+   */
+  bool doesItContain(Instruction *inst) const;
+
+  /*
+   * Return the number of instructions that compose the SCCDAG.
+   */
+  int64_t numberOfInstructions(void);
+
+  /*
+   * Iterate over SCCs until @funcToInvoke returns true or no other SCC exists.
+   */
+  bool iterateOverSCCs(std::function<bool(SCC *)> funcToInvoke);
+
+  /*
+   * Return the range that includes all SCCs.
+   */
+  std::unordered_set<SCC *> getSCCs(void);
+
+  /*
+   * Iterate over instructions inside the SCCDAG until @funcToInvoke returns
+   * true or no other instruction exists.
+   */
+  bool iterateOverInstructions(std::function<bool(Instruction *)> funcToInvoke);
+
+  /*
+   * Iterate over live-ins and live-outs of the code region represented by the
+   * SCCDAG until @funcToInvoke returns true or no other live-in and live-out
+   * exist.
+   */
+  bool iterateOverLiveInAndLiveOut(std::function<bool(Value *)> funcToInvoke);
+
+  /*
+   * Iterate over all instructions (internal and external) until @funcToInvoke
+   * returns true or no other instruction exists. External nodes represent
+   * live-ins and live-outs of the code region represented by the SCCDAG.
+   */
+  bool iterateOverAllInstructions(
+      std::function<bool(Instruction *)> funcToInvoke);
+
+  /*
+   * Iterate over all values (internal and external) until @funcToInvoke returns
+   * true or no other value exists. External values represent live-ins and
+   * live-outs of the code region represented by the SCCDAG.
+   */
+  bool iterateOverAllValues(std::function<bool(Value *)> funcToInvoke);
+
+  /*
+   * Merge SCCs of @sccSet to become a single node of the SCCDAG.
+   */
+  void mergeSCCs(std::set<DGNode<SCC> *> &sccSet);
+
+  /*
+   * Remove the dependences @edges from @dependenceGraph, which must be the
+   * graph "this" SCCDAG has been computed from, and update the SCCDAG.
+   *
+   * Only the SCCs that contain an end of a removed dependence are recomputed
+   * (and possibly split). These SCCs are replaced by new ones. The reachability
+   * among SCCs is recomputed only for the SCCs that could reach them.
+   */
+  void removeDependences(
+      PDG *dependenceGraph,
+      std::unordered_set<DGEdge<Value, Value> *> const &edges);
+
+  /*
+   * Return the SCC that contains @val
+   */
+  SCC *sccOfValue(Value *val) const;
+
+  /*
+   * Define a collection of SCCs type.
+   */
+  typedef std::vector<SCC *> SCCSet;
+
+  /*
+   * Compute ordering between nodes of the SCCDAG.
+   */
+  bool orderedBefore(const SCC *earlySCC, const SCCSet &lates) const;
+  bool orderedBefore(const SCCSet &earlies, const SCC *lateSCC) const;
+  bool orderedBefore(const SCC *earlySCC, const SCC *lateSCC) const;
+
+  /*
+   * Get the index of a node of the SCCDAG.
+   * Indexes are dense and they are stored in the SCCs, so this is O(1).
+   */
+  uint32_t getSCCIndex(const SCC *scc) const;
+
+  /*
+   * Deconstructor.
+   */
+  ~SCCDAG();
+
+protected:
+  void markValuesInSCC(void);
+  void markEdgesAndSubEdges(void);
+
+  std::unordered_map<Value *, DGNode<SCC> *> valueToSCCNode;
+
+private:
+  /*
+   * BitMatrix for keeping the topological order of the SCCDAG nodes.
+   */
+  BitMatrix ordered;
+
+  /*
+   * ordered_dirty is true if the ordering of SCCDAG nodes is invalid.
+   */
+  bool orderedDirty;
+
+  /*
+   * Indexes of the bit matrix that are not used by any node of the SCCDAG.
+   */
+  std::vector<uint32_t> freeSCCIndexes;
+
+  /*
+   * Compute transitive dependences between nodes of the SCCDAG.
+   */
+  void computeReachabilityAmongSCCs(void);
+
+  /*
+   * Recompute the transitive dependences of @sccNodes, which must include all
+   * nodes that can reach any of them.
+   */
+  void computeReachabilityOf(std::unordered_set<DGNode<SCC> *> &sccNodes);
+
+  /*
+   * Add the dependences between SCCs that have at least one end in
+   * @newSCCNodes. The other end of these dependences is either in @newSCCNodes
+   * or in @neighbors.
+   */
+  void markEdgesAndSubEdgesOf(
+      std::unordered_set<DGNode<SCC> *> const &newSCCNodes,
+      std::unordered_set<DGNode<SCC> *> const &neighbors);
+
+  /*
+   * Compute the SCCs of the sub-graph that includes only the nodes @nodes and
+   * the dependences among them.
+   */
+  static std::vector<std::set<DGNode<Value> *>> computeSCCsOf(
+      std::set<DGNode<Value> *> const &nodes);
+};
+
+} // namespace arcana::noelle
+
+#endif // NOELLE_SRC_CORE_SCCDAG_H_
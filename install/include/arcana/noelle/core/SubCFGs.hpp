@@ -0,0 +1,61 @@
+/*
+ * Copyright 2016 - 2024  Angelo Matni, Simone Campanoni
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifndef NOELLE_SRC_CORE_DG_SUBCFGS_H_
+#define NOELLE_SRC_CORE_DG_SUBCFGS_H_
+
+#include "llvm/Support/GraphWriter.h"
+#include "arcana/noelle/core/DGBase.hpp"
+
+namespace arcana::noelle {
+
+/*
+ * Execution Graph.
+ */
+class SubCFGs : public DG<BasicBlock> {
+public:
+  /*
+   * Add all basic blocks included in the module M as nodes.
+   */
+  SubCFGs(Module &M);
+
+  /*
+   * Add all basic blocks included in the function F as nodes.
+   */
+  SubCFGs(Function &F);
+
+  /*
+   * Add all basic blocks included in the loop only.
+   */
+  SubCFGs(Loop *loop);
+
+  /*
+   * Add all basic blocks given
+   */
+  SubCFGs(std::set<BasicBlock *> &bbs);
+
+private:
+  void connectBasicBlockNodes();
+};
+
+} // namespace arcana::noelle
+
+#endif // NOELLE_SRC_CORE_DG_SUBCFGS_H_
@@ -0,0 +1,134 @@
+/*
+ * Copyright 2016 - 2024  Angelo Matni, Simone Campanoni
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+#include "llvm/Pass.h"
+#include "llvm/IR/Function.h"
+#include "llvm/IR/BasicBlock.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/InstIterator.h"
+
+#include "TestSuite.hpp"
+#include "arcana/noelle/core/NoellePass.hpp"
+#include "arcana/noelle/core/DependenceAnalysisDispatcher.hpp"
+
+#include <sstream>
+#include <vector>
+#include <string>
+
+using namespace parallelizertests;
+using namespace arcana::noelle;
+
+namespace llvm {
+
+/*
+ * Dependence analysis that answers every query about the type of a memory
+ * data dependence with @verdict, and records the order of its invocations in
+ * @invocations.
+ * It declares itself intraprocedural if @intraprocedural is set.
+ */
+class FixedVerdictAnalysis : public DependenceAnalysis {
+public:
+  FixedVerdictAnalysis(const std::string &name,
+                       MemoryDataDependenceStrength verdict,
+                       std::vector<std::string> &invocations);
+
+  MemoryDataDependenceStrength isThereThisMemoryDataDependenceType(
+      DataDependenceType t,
+      Instruction *fromInst,
+      Instruction *toInst,
+      Function &function) override;
+
+  MemoryDataDependenceStrength isThereThisMemoryDataDependenceType(
+      DataDependenceType t,
+      Instruction *fromInst,
+      Instruction *toInst,
+      LoopStructure &loop) override;
+
+  bool isIntraprocedural(void) const override;
+
+  MemoryDataDependenceStrength verdict;
+  bool intraprocedural;
+
+private:
+  std::vector<std::string> &invocations;
+};
+
+class DADTestSuite : public ModulePass {
+public:
+  DADTestSuite() : ModulePass{ ID } {}
+
+  /*
+   * Class fields
+   */
+  static char ID;
+  static const char *tests[];
+  static parallelizertests::TestFunction testFns[];
+
+  bool doInitialization(Module &M) override;
+  bool runOnModule(Module &M) override;
+  void getAnalysisUsage(AnalysisUsage &AU) const override;
+
+private:
+  static Values independenceWinsOverMustDependence(ModulePass &pass,
+                                                   TestSuite &suite);
+  static Values mustDependenceWinsOverMayDependence(ModulePass &pass,
+                                                    TestSuite &suite);
+  static Values analysesAreInvokedInInsertionOrder(ModulePass &pass,
+                                                   TestSuite &suite);
+  static Values intraproceduralVerdictsAreCached(ModulePass &pass,
+                                                 TestSuite &suite);
+  static Values otherVerdictsAreNotCached(ModulePass &pass, TestSuite &suite);
+  static Values verdictsAboutCallsAreNotCached(ModulePass &pass,
+                                               TestSuite &suite);
+
+  /*
+   * Verdicts of a dispatcher with one analysis per element of @verdicts,
+   * added in that order, about the RAW dependence from the store to the load
+   * of the loop of main: first for the function, then for the loop.
+   */
+  static std::pair<MemoryDataDependenceStrength, MemoryDataDependenceStrength>
+  dispatch(DADTestSuite &pass,
+           std::vector<MemoryDataDependenceStrength> const &verdicts);
+
+  /*
+   * Ask twice a dispatcher with one analysis about the RAW dependence from the
+   * store of the loop of main to @toInst within the loop.
+   * The analysis answers MUST_EXIST to the first query and CANNOT_EXIST to
+   * the second one, which is returned with the number of cached queries.
+   */
+  static std::pair<MemoryDataDependenceStrength, uint64_t> queryTwice(
+      DADTestSuite &pass,
+      bool intraprocedural,
+      Instruction *toInst);
+
+  static std::string getName(MemoryDataDependenceStrength verdict);
+
+  TestSuite *suite;
+  Module *M;
+  Noelle *noelle;
+  LoopStructure *loop;
+  StoreInst *store;
+  LoadInst *load;
+  CallBase *call;
+};
+} // namespace llvm
@@ -0,0 +1,71 @@
+/*
+ * Copyright 2016 - 2024  Angelo Matni, Simone Campanoni
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+#include "llvm/Pass.h"
+#include "llvm/IR/Function.h"
+#include "llvm/IR/BasicBlock.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/Support/FileSystem.h"
+
+#include "TestSuite.hpp"
+#include "arcana/noelle/core/HotProfileCache.hpp"
+
+#include <sstream>
+#include <vector>
+#include <string>
+#include <unordered_map>
+
+using namespace parallelizertests;
+
+namespace llvm {
+
+class HPCTestSuite : public ModulePass {
+public:
+  HPCTestSuite() : ModulePass{ ID } {}
+
+  /*
+   * Class fields
+   */
+  static char ID;
+  static const char *tests[];
+  static parallelizertests::TestFunction testFns[];
+
+  bool doInitialization(Module &M) override;
+  bool runOnModule(Module &M) override;
+  void getAnalysisUsage(AnalysisUsage &AU) const override;
+
+private:
+  static Values cacheRoundTrips(ModulePass &pass, TestSuite &suite);
+  static Values staleEntriesAreRejected(ModulePass &pass, TestSuite &suite);
+  static Values missingCacheIsInvalid(ModulePass &pass, TestSuite &suite);
+
+  static bool writeCache(Module &M, std::string &fileName);
+
+  static std::vector<Function *> restoredFunctions(
+      Module &M,
+      arcana::noelle::HotProfileCache &cache);
+
+  TestSuite *suite;
+  Module *M;
+};
+} // namespace llvm
@@ -19,24 +19,309 @@
  OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
  OR OTHER DEALINGS IN THE SOFTWARE.
  */
+#include <fstream>
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/Path.h"
 #include "arcana/noelle/core/Architecture.hpp"
 
 namespace arcana::noelle {
 
+std::string Architecture::systemRoot = "/sys";
+
+std::unique_ptr<Architecture::Topology> Architecture::topology = nullptr;
+
+std::mutex Architecture::topologyLock;
+
 Architecture::Architecture() {
   return;
 }
 
+void Architecture::setSystemRoot(std::string root) {
+  std::lock_guard<std::mutex> guard(Architecture::topologyLock);
+  Architecture::systemRoot = root;
+  Architecture::topology = nullptr;
+
+  return;
+}
+
 uint32_t Architecture::getNumberOfLogicalCores(void) {
-  return std::thread::hardware_concurrency();
+  return Architecture::getTopology().logicalCores;
 }
 
 uint32_t Architecture::getNumberOfPhysicalCores(void) {
-  return getNumberOfLogicalCores() / 2;
+  return Architecture::getTopology().physicalCores;
+}
+
+uint32_t Architecture::getNumberOfLogicalCoresPerPhysicalCore(void) {
+  return Architecture::getTopology().logicalCoresPerPhysicalCore;
+}
+
+uint32_t Architecture::getNumberOfNUMANodes(void) {
+  return Architecture::getTopology().coresOfNUMANode.size();
+}
+
+uint32_t Architecture::getNUMANodeOfLogicalCore(uint32_t logicalCore) {
+  auto &t = Architecture::getTopology();
+  auto it = t.numaNodeOfCore.find(logicalCore);
+  if (it == t.numaNodeOfCore.end()) {
+    return 0;
+  }
+
+  return it->second;
+}
+
+std::vector<uint32_t> Architecture::getLogicalCoresOfNUMANode(uint32_t node) {
+  auto &t = Architecture::getTopology();
+  auto it = t.coresOfNUMANode.find(node);
+  if (it == t.coresOfNUMANode.end()) {
+    return {};
+  }
+
+  return it->second;
+}
+
+uint32_t Architecture::getNumberOfCacheLevels(void) {
+  auto &t = Architecture::getTopology();
+  if (t.cacheBytes.empty()) {
+    return 0;
+  }
+
+  return t.cacheBytes.rbegin()->first;
+}
+
+uint64_t Architecture::getCacheBytes(uint32_t level) {
+  auto &t = Architecture::getTopology();
+  auto it = t.cacheBytes.find(level);
+  if (it == t.cacheBytes.end()) {
+    return 0;
+  }
+
+  return it->second;
 }
 
 int32_t Architecture::getCacheLineBytes(void) {
-  return 64;
+  return Architecture::getTopology().cacheLineBytes;
+}
+
+const Architecture::Topology &Architecture::getTopology(void) {
+  std::lock_guard<std::mutex> guard(Architecture::topologyLock);
+  if (Architecture::topology == nullptr) {
+    Architecture::topology = Architecture::readTopology();
+  }
+
+  return *Architecture::topology;
+}
+
+std::unique_ptr<Architecture::Topology> Architecture::readTopology(void) {
+  auto t = std::make_unique<Topology>();
+  auto cpuDir = Architecture::systemRoot + "/devices/system/cpu/";
+  auto nodeDir = Architecture::systemRoot + "/devices/system/node/";
+
+  /*
+   * Fetch the logical cores that are online.
+   * If sysfs is not available, fall back to what the C++ runtime tells us.
+   */
+  std::vector<uint32_t> cores;
+  if (auto online = Architecture::readFile(cpuDir + "online")) {
+    cores = Architecture::parseListOfCores(*online);
+  }
+  if (cores.empty()) {
+    auto n = std::max(std::thread::hardware_concurrency(), 1u);
+    for (auto i = 0u; i < n; i++) {
+      cores.push_back(i);
+    }
+  }
+  t->logicalCores = cores.size();
+
+  /*
+   * Compute the physical cores by grouping the logical cores that share the
+   * same package and core IDs.
+   */
+  std::set<std::pair<uint64_t, uint64_t>> physicalCores;
+  for (auto core : cores) {
+    auto topologyDir = cpuDir + "cpu" + std::to_string(core) + "/topology/";
+    auto packageID =
+        Architecture::readNumber(topologyDir + "physical_package_id");
+    auto coreID = Architecture::readNumber(topologyDir + "core_id");
+    if (!packageID || !coreID) {
+      physicalCores.clear();
+      break;
+    }
+    physicalCores.insert(std::make_pair(*packageID, *coreID));
+  }
+  if (!physicalCores.empty()) {
+    t->physicalCores = physicalCores.size();
+  } else {
+
+    /*
+     * The topology is unknown.
+     * Assume two-way SMT as done before the topology was read from sysfs.
+     */
+    t->physicalCores = std::max(t->logicalCores / 2, 1u);
+  }
+
+  /*
+   * Compute the number of SMT siblings.
+   */
+  t->logicalCoresPerPhysicalCore =
+      std::max(t->logicalCores / t->physicalCores, 1u);
+  auto siblingsFile = cpuDir + "cpu" + std::to_string(cores.front())
+                      + "/topology/thread_siblings_list";
+  if (auto siblings = Architecture::readFile(siblingsFile)) {
+    auto siblingCores = Architecture::parseListOfCores(*siblings);
+    if (!siblingCores.empty()) {
+      t->logicalCoresPerPhysicalCore = siblingCores.size();
+    }
+  }
+
+  /*
+   * Fetch the NUMA nodes.
+   */
+  std::error_code ec;
+  for (sys::fs::directory_iterator it(nodeDir, ec), end; !ec && (it != end);
+       it.increment(ec)) {
+    auto name = sys::path::filename(it->path());
+    if (!name.startswith("node")) {
+      continue;
+    }
+    uint32_t node;
+    if (name.drop_front(4).getAsInteger(10, node)) {
+      continue;
+    }
+    auto cpuList = Architecture::readFile(it->path() + "/cpulist");
+    if (!cpuList) {
+      continue;
+    }
+    auto &nodeCores = t->coresOfNUMANode[node];
+    for (auto core : Architecture::parseListOfCores(*cpuList)) {
+      t->numaNodeOfCore[core] = node;
+      nodeCores.push_back(core);
+    }
+  }
+  if (t->coresOfNUMANode.empty()) {
+    t->coresOfNUMANode[0] = cores;
+    for (auto core : cores) {
+      t->numaNodeOfCore[core] = 0;
+    }
+  }
+
+  /*
+   * Fetch the data and unified caches seen by the first logical core.
+   */
+  t->cacheLineBytes = 0;
+  auto cacheDir = cpuDir + "cpu" + std::to_string(cores.front()) + "/cache/";
+  for (sys::fs::directory_iterator it(cacheDir, ec), end; !ec && (it != end);
+       it.increment(ec)) {
+    auto name = sys::path::filename(it->path());
+    if (!name.startswith("index")) {
+      continue;
+    }
+    auto indexDir = it->path() + "/";
+    auto type = Architecture::readFile(indexDir + "type");
+    if (!type || (*type == "Instruction")) {
+      continue;
+    }
+    auto level = Architecture::readNumber(indexDir + "level");
+    auto size = Architecture::readFile(indexDir + "size");
+    if (!level || !size) {
+      continue;
+    }
+    t->cacheBytes[*level] = Architecture::parseSize(*size);
+
+    /*
+     * The cache line of the machine is the one of the L1 data cache.
+     */
+    if (*level == 1) {
+      auto lineBytes =
+          Architecture::readNumber(indexDir + "coherency_line_size");
+      if (lineBytes) {
+        t->cacheLineBytes = *lineBytes;
+      }
+    }
+  }
+  if (t->cacheLineBytes <= 0) {
+    t->cacheLineBytes = 64;
+  }
+
+  return t;
+}
+
+std::optional<std::string> Architecture::readFile(std::string fileName) {
+  std::ifstream file(fileName);
+  if (!file.is_open()) {
+    return std::nullopt;
+  }
+  std::string content;
+  std::getline(file, content);
+  if (file.bad()) {
+    return std::nullopt;
+  }
+
+  return StringRef(content).trim().str();
+}
+
+std::optional<uint64_t> Architecture::readNumber(std::string fileName) {
+  auto content = Architecture::readFile(fileName);
+  if (!content) {
+    return std::nullopt;
+  }
+  uint64_t n;
+  if (StringRef(*content).getAsInteger(10, n)) {
+    return std::nullopt;
+  }
+
+  return n;
+}
+
+std::vector<uint32_t> Architecture::parseListOfCores(std::string list) {
+
+  /*
+   * Lists have the format "0-3,8,10-11".
+   */
+  std::vector<uint32_t> cores;
+  SmallVector<StringRef, 8> ranges;
+  StringRef(list).split(ranges, ',', -1, false);
+  for (auto range : ranges) {
+    auto bounds = range.trim().split('-');
+    uint32_t first;
+    if (bounds.first.getAsInteger(10, first)) {
+      return {};
+    }
+    auto last = first;
+    if (!bounds.second.empty() && bounds.second.getAsInteger(10, last)) {
+      return {};
+    }
+    for (auto core = first; core <= last; core++) {
+      cores.push_back(core);
+    }
+  }
+
+  return cores;
+}
+
+uint64_t Architecture::parseSize(std::string size) {
+
+  /*
+   * Sizes have the format "32K".
+   */
+  StringRef s(size);
+  uint64_t multiplier = 1;
+  if (s.endswith("K")) {
+    multiplier = 1024;
+  } else if (s.endswith("M")) {
+    multiplier = 1024 * 1024;
+  } else if (s.endswith("G")) {
+    multiplier = 1024 * 1024 * 1024;
+  }
+  if (multiplier != 1) {
+    s = s.drop_back();
+  }
+  uint64_t n;
+  if (s.getAsInteger(10, n)) {
+    return 0;
+  }
+
+  return n * multiplier;
 }
 
 } // namespace arcana::noelle
@@ -0,0 +1,134 @@
+/*
+ * Copyright 2024  Simone Campanoni
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifndef NOELLE_SRC_CORE_BASIC_UTILITIES_FUNCTIONSECTIONSFILE_H_
+#define NOELLE_SRC_CORE_BASIC_UTILITIES_FUNCTIONSECTIONSFILE_H_
+
+#include "llvm/ADT/StringMap.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "arcana/noelle/core/SystemHeaders.hpp"
+
+namespace arcana::noelle {
+
+/*
+ * Binary file that stores one section of data per function of a module, so
+ * the data of a function can be loaded on its own.
+ *
+ * The file is composed by:
+ *   - a fixed header: a magic, a version, and the 64-bit words the format of
+ *     the file defines (e.g., hashes of the module);
+ *   - the directory of the functions (ULEB128 encoded): for each function,
+ *     its name, its hash (see IRHash), and the offset and size of its
+ *     section;
+ *   - the sections of the functions, whose content is up to the format.
+ *
+ * The file is loaded through a memory-mapped buffer.
+ */
+class FunctionSectionsFile {
+public:
+  struct Section {
+    uint64_t hash;
+    const uint8_t *begin;
+    const uint8_t *end;
+  };
+
+  /*
+   * Map @fileName, which is valid if it starts with @magic and @version
+   * followed by @numberOfHeaderWords words.
+   */
+  FunctionSectionsFile(const std::string &fileName,
+                       const char (&magic)[8],
+                       uint32_t version,
+                       uint32_t numberOfHeaderWords);
+
+  FunctionSectionsFile() = delete;
+
+  /*
+   * Check if the file exists and it is well formed.
+   */
+  bool isValid(void) const;
+
+  /*
+   * Return the header word @index.
+   */
+  uint64_t getHeaderWord(uint32_t index) const;
+
+  /*
+   * Return the section of the function @functionName, or nullptr if the file
+   * does not store it.
+   */
+  const Section *getSection(StringRef functionName) const;
+
+private:
+  std::unique_ptr<MemoryBuffer> file;
+  bool valid;
+  std::vector<uint64_t> headerWords;
+  StringMap<Section> sections;
+};
+
+/*
+ * Writer of a FunctionSectionsFile.
+ */
+class FunctionSectionsFileWriter {
+public:
+  FunctionSectionsFileWriter(const char (&magic)[8], uint32_t version);
+
+  FunctionSectionsFileWriter() = delete;
+
+  /*
+   * Add the section of the function @functionName, whose hash is @hash, with
+   * the content encoded by @encode.
+   */
+  void addSection(StringRef functionName,
+                  uint64_t hash,
+                  std::function<void(raw_ostream &out)> encode);
+
+  /*
+   * Write the file into @fileName with the header words @headerWords.
+   * The file is written to a temporary file first, which is then renamed to
+   * @fileName: the current @fileName may be mapped by a live reader, and
+   * renaming keeps that mapping on the old file while truncating the file in
+   * place would change the bytes under it.
+   * Errors are reported to errs() prefixed by @writerName.
+   * Return true if the file has been written.
+   */
+  bool write(const std::string &fileName,
+             std::vector<uint64_t> const &headerWords,
+             StringRef writerName);
+
+private:
+  struct DirectoryEntry {
+    std::string functionName;
+    uint64_t hash;
+    uint64_t offset;
+    uint64_t size;
+  };
+
+  const char *magic;
+  uint32_t version;
+  std::vector<DirectoryEntry> directory;
+  std::string sectionsBuffer;
+  raw_string_ostream sectionsOut;
+};
+
+} // namespace arcana::noelle
+
+#endif // NOELLE_SRC_CORE_BASIC_UTILITIES_FUNCTIONSECTIONSFILE_H_
@@ -0,0 +1,60 @@
+/*
+ * Copyright 2024  Simone Campanoni
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifndef NOELLE_SRC_CORE_BASIC_UTILITIES_IRHASH_H_
+#define NOELLE_SRC_CORE_BASIC_UTILITIES_IRHASH_H_
+
+#include "arcana/noelle/core/SystemHeaders.hpp"
+
+namespace arcana::noelle {
+
+/*
+ * Hashes of the IR that identify whether a function or the global values of a
+ * module changed, so data computed for them can be stored in a file and
+ * reused later.
+ * Values are hashed by what they are rather than by their address, so the
+ * hashes are stable across runs.
+ */
+class IRHash {
+public:
+  /*
+   * Hash of @F: its signature, its attributes, its instructions, their
+   * operands, and the metadata of the instructions that alias analyses rely
+   * on.
+   * Types are hashed structurally, so a change of the layout of a struct
+   * changes the hash even if the name of the struct does not.
+   */
+  static uint64_t computeFunctionHash(Function &F);
+
+  /*
+   * Hash of the data layout, of the global variables, and of the function
+   * declarations of @M.
+   */
+  static uint64_t computeGlobalsHash(Module &M);
+
+  static uint64_t hashString(StringRef s);
+
+  static uint64_t hashWords(std::vector<uint64_t> const &words);
+};
+
+} // namespace arcana::noelle
+
+#endif // NOELLE_SRC_CORE_BASIC_UTILITIES_IRHASH_H_
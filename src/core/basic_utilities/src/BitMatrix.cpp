@@ -4,78 +4,119 @@ namespace llvm {
 
 void BitMatrix::resize(uint32_t n) {
   N = n;
-  bv.clear();
-  bv.resize(n * n);
+  wordsPerRow = numberOfWords(n);
+  words.assign(static_cast<uint64_t>(n) * wordsPerRow, 0);
 }
 
-uint32_t BitMatrix::idx(uint32_t row, uint32_t col) const {
+void BitMatrix::grow(uint32_t n) {
+  assert(n >= N);
+  if (n == N) {
+    return;
+  }
+
+  const uint32_t newWordsPerRow = numberOfWords(n);
+  std::vector<uint64_t> newWords(static_cast<uint64_t>(n) * newWordsPerRow, 0);
+  for (uint32_t row = 0; row < N; ++row) {
+    std::copy(words.begin() + rowBegin(row),
+              words.begin() + rowBegin(row) + wordsPerRow,
+              newWords.begin() + static_cast<uint64_t>(row) * newWordsPerRow);
+  }
+  N = n;
+  wordsPerRow = newWordsPerRow;
+  words = std::move(newWords);
+}
+
+uint32_t BitMatrix::size() const {
+  return N;
+}
+
+void BitMatrix::resetRow(uint32_t row) {
   assert(row < N);
-  assert(col < N);
-  return row * N + col;
+  std::fill(words.begin() + rowBegin(row),
+            words.begin() + rowBegin(row) + wordsPerRow,
+            0);
+}
+
+bool BitMatrix::unionRows(uint32_t row, uint32_t otherRow) {
+  assert(row < N);
+  assert(otherRow < N);
+  uint64_t *dst = words.data() + rowBegin(row);
+  const uint64_t *src = words.data() + rowBegin(otherRow);
+
+  // No early exit, so that the loop can be vectorized
+  uint64_t changed = 0;
+  for (uint32_t i = 0; i < wordsPerRow; ++i) {
+    const uint64_t merged = dst[i] | src[i];
+    changed |= merged ^ dst[i];
+    dst[i] = merged;
+  }
+
+  return changed != 0;
+}
+
+uint64_t BitMatrix::rowBegin(uint32_t row) const {
+  return static_cast<uint64_t>(row) * wordsPerRow;
 }
 
 uint32_t BitMatrix::count() const {
-  return bv.count();
+  uint32_t c = 0;
+  for (auto word : words) {
+    c += countPopulation(word);
+  }
+  return c;
 }
 
 void BitMatrix::set(uint32_t row, uint32_t col, bool v) {
-  const uint32_t i = idx(row, col);
+  assert(row < N);
+  assert(col < N);
+  const uint64_t mask = uint64_t(1) << (col % 64);
+  auto &word = words[rowBegin(row) + col / 64];
 
   if (v) {
-    bv.set(i);
+    word |= mask;
   } else {
-    bv.reset(i);
+    word &= ~mask;
   }
 }
 
 bool BitMatrix::test(uint32_t row, uint32_t col) const {
-  const uint32_t i = idx(row, col);
+  assert(row < N);
+  assert(col < N);
+  const uint64_t mask = uint64_t(1) << (col % 64);
 
-  return bv.test(i);
+  return (words[rowBegin(row) + col / 64] & mask) != 0;
 }
 
-int32_t BitMatrix::firstSuccessor(uint32_t row) const {
-  const uint32_t rowBegin = N * row;
-  int32_t next = -1;
-
-  if (0 == rowBegin) {
-    next = bv.find_first();
-  } else {
-    next = bv.find_next(rowBegin - 1);
-  }
-
-  if (-1 == next) {
+int32_t BitMatrix::findFrom(uint32_t row, uint32_t col) const {
+  if (col >= N) {
     return -1;
   }
 
-  const uint32_t rowEnd = rowBegin + N;
-  if (((uint32_t)next) >= rowEnd) {
-    return -1;
+  const uint64_t *r = words.data() + rowBegin(row);
+  uint32_t wordIndex = col / 64;
+  uint64_t word = r[wordIndex] & (~uint64_t(0) << (col % 64));
+  while (word == 0) {
+    ++wordIndex;
+    if (wordIndex >= wordsPerRow) {
+      return -1;
+    }
+    word = r[wordIndex];
   }
 
-  return next - rowBegin;
+  return wordIndex * 64 + countTrailingZeros(word);
 }
 
-int32_t BitMatrix::nextSuccessor(uint32_t row, uint32_t prev) const {
-  int32_t next = bv.find_next(N * row + prev);
-  if (-1 == next) {
-    return -1;
-  }
-
-  const uint32_t rowBegin = N * row;
-  const uint32_t rowEnd = rowBegin + N;
-  if (((uint32_t)next) >= rowEnd) {
-    return -1;
-  }
+int32_t BitMatrix::firstSuccessor(uint32_t row) const {
+  return findFrom(row, 0);
+}
 
-  return next - rowBegin;
+int32_t BitMatrix::nextSuccessor(uint32_t row, uint32_t prev) const {
+  return findFrom(row, prev + 1);
 }
 
 void BitMatrix::transitiveClosure() {
-  uint32_t nAdd = 0;
-
-  typedef std::list<uint32_t> Worklist;
-  Worklist worklist;
+  std::deque<uint32_t> worklist;
+  std::vector<bool> isInWorklist(N, true);
   for (uint32_t i = 0; i < N; ++i) {
     worklist.push_back(i);
   }
@@ -83,37 +124,43 @@ void BitMatrix::transitiveClosure() {
   while (!worklist.empty()) {
     uint32_t i = worklist.front();
     worklist.pop_front();
+    isInWorklist[i] = false;
 
     bool changedI = false;
 
     // (i->j)
     for (int32_t j = firstSuccessor(i); j != -1; j = nextSuccessor(i, j)) {
-      // bit-wise or row[i] |= row[j]
-
-      // (j->k)
-      for (int32_t k = firstSuccessor(j); k != -1; k = nextSuccessor(j, k)) {
-        // but not (i->k)
-        if (!test(i, k)) {
-          changedI = true;
-          ++nAdd;
-          set(i, k);
-        }
-      }
+      // row[i] |= row[j]
+      changedI |= unionRows(i, j);
     }
 
     if (changedI) {
       for (uint32_t p = 0; p < N; ++p) {
-        if (test(p, i)) {
-          if (std::find(worklist.begin(), worklist.end(), p)
-              == worklist.end()) {
-            worklist.push_back(p);
-          }
+        if (test(p, i) && !isInWorklist[p]) {
+          isInWorklist[p] = true;
+          worklist.push_back(p);
         }
       }
     }
   }
 }
 
+void BitMatrix::transitiveClosure(const std::vector<uint32_t> &order) {
+  assert(order.size() == N);
+
+  for (auto i : order) {
+    // The rows i is related to are closed already.
+    // Iterate over a snapshot of the direct successors, as row i grows.
+    SmallVector<uint32_t, 8> successors;
+    for (int32_t j = firstSuccessor(i); j != -1; j = nextSuccessor(i, j)) {
+      successors.push_back(j);
+    }
+    for (auto j : successors) {
+      unionRows(i, j);
+    }
+  }
+}
+
 void BitMatrix::dump(raw_ostream &fout) const {
   for (uint32_t row = 0; row < N; ++row) {
     for (uint32_t col = 0; col < N; ++col) {
@@ -0,0 +1,236 @@
+/*
+ * Copyright 2024  Simone Campanoni
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "llvm/Support/EndianStream.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/LEB128.h"
+#include "arcana/noelle/core/FunctionSectionsFile.hpp"
+
+namespace arcana::noelle {
+
+FunctionSectionsFile::FunctionSectionsFile(const std::string &fileName,
+                                           const char (&magic)[8],
+                                           uint32_t version,
+                                           uint32_t numberOfHeaderWords)
+  : file{ nullptr },
+    valid{ false } {
+
+  /*
+   * Map the file.
+   */
+  auto fileOrError = MemoryBuffer::getFile(fileName,
+                                           /*IsText=*/false,
+                                           /*RequiresNullTerminator=*/false);
+  if (!fileOrError) {
+    return;
+  }
+  this->file = std::move(*fileOrError);
+  auto p = reinterpret_cast<const uint8_t *>(this->file->getBufferStart());
+  auto end = reinterpret_cast<const uint8_t *>(this->file->getBufferEnd());
+
+  /*
+   * Parse the header.
+   */
+  auto headerSize =
+      sizeof(magic) + sizeof(uint32_t) + numberOfHeaderWords * sizeof(uint64_t);
+  if (static_cast<size_t>(end - p) < headerSize) {
+    return;
+  }
+  if (std::memcmp(p, magic, sizeof(magic)) != 0) {
+    return;
+  }
+  p += sizeof(magic);
+  auto fileVersion =
+      support::endian::readNext<uint32_t, support::little, support::unaligned>(
+          p);
+  if (fileVersion != version) {
+    return;
+  }
+  for (auto i = 0u; i < numberOfHeaderWords; i++) {
+    this->headerWords.push_back(
+        support::endian::
+            readNext<uint64_t, support::little, support::unaligned>(p));
+  }
+
+  /*
+   * Parse the directory of the functions.
+   */
+  const char *error = nullptr;
+  auto next = [&p, end, &error]() -> uint64_t {
+    unsigned n = 0;
+    auto value = decodeULEB128(p, &n, end, &error);
+    p += n;
+    return value;
+  };
+  struct DirectoryEntry {
+    StringRef functionName;
+    uint64_t hash;
+    uint64_t offset;
+    uint64_t size;
+  };
+  std::vector<DirectoryEntry> directory;
+  auto numberOfFunctions = next();
+  for (auto i = 0u; (i < numberOfFunctions) && (error == nullptr); i++) {
+    auto nameLength = next();
+    if ((error != nullptr)
+        || (static_cast<uint64_t>(end - p) < (nameLength + sizeof(uint64_t)))) {
+      return;
+    }
+    DirectoryEntry entry;
+    entry.functionName =
+        StringRef(reinterpret_cast<const char *>(p), nameLength);
+    p += nameLength;
+    entry.hash = support::endian::
+        readNext<uint64_t, support::little, support::unaligned>(p);
+    entry.offset = next();
+    entry.size = next();
+    directory.push_back(entry);
+  }
+  if (error != nullptr) {
+    return;
+  }
+
+  /*
+   * Check the sections are within the file.
+   */
+  auto sectionsSize = static_cast<uint64_t>(end - p);
+  for (auto &entry : directory) {
+    if ((entry.offset > sectionsSize)
+        || (entry.size > (sectionsSize - entry.offset))) {
+      return;
+    }
+    auto begin = p + entry.offset;
+    this->sections[entry.functionName] = { entry.hash,
+                                           begin,
+                                           begin + entry.size };
+  }
+  this->valid = true;
+
+  return;
+}
+
+bool FunctionSectionsFile::isValid(void) const {
+  return this->valid;
+}
+
+uint64_t FunctionSectionsFile::getHeaderWord(uint32_t index) const {
+  assert(this->valid);
+  assert(index < this->headerWords.size());
+
+  return this->headerWords[index];
+}
+
+const FunctionSectionsFile::Section *FunctionSectionsFile::getSection(
+    StringRef functionName) const {
+  if (!this->valid) {
+    return nullptr;
+  }
+  auto it = this->sections.find(functionName);
+  if (it == this->sections.end()) {
+    return nullptr;
+  }
+
+  return &it->getValue();
+}
+
+FunctionSectionsFileWriter::FunctionSectionsFileWriter(const char (&magic)[8],
+                                                       uint32_t version)
+  : magic{ magic },
+    version{ version },
+    sectionsOut{ sectionsBuffer } {
+  return;
+}
+
+void FunctionSectionsFileWriter::addSection(
+    StringRef functionName,
+    uint64_t hash,
+    std::function<void(raw_ostream &out)> encode) {
+  auto offset = this->sectionsOut.tell();
+  encode(this->sectionsOut);
+  auto size = this->sectionsOut.tell() - offset;
+  this->directory.push_back({ functionName.str(), hash, offset, size });
+
+  return;
+}
+
+bool FunctionSectionsFileWriter::write(
+    const std::string &fileName,
+    std::vector<uint64_t> const &headerWords,
+    StringRef writerName) {
+  this->sectionsOut.flush();
+
+  /*
+   * Encode the header and the directory of the functions.
+   */
+  std::string buffer;
+  raw_string_ostream out(buffer);
+  out.write(this->magic, 8);
+  support::endian::write<uint32_t>(out, this->version, support::little);
+  for (auto word : headerWords) {
+    support::endian::write<uint64_t>(out, word, support::little);
+  }
+  encodeULEB128(this->directory.size(), out);
+  for (auto &entry : this->directory) {
+    encodeULEB128(entry.functionName.size(), out);
+    out << entry.functionName;
+    support::endian::write<uint64_t>(out, entry.hash, support::little);
+    encodeULEB128(entry.offset, out);
+    encodeULEB128(entry.size, out);
+  }
+  out.flush();
+
+  /*
+   * Write a temporary file next to @fileName and rename it into place.
+   */
+  int fd;
+  SmallString<128> temporaryFileName;
+  auto ec = sys::fs::createUniqueFile(fileName + ".%%%%%%.tmp",
+                                      fd,
+                                      temporaryFileName);
+  if (ec) {
+    errs() << writerName << ": cannot create a temporary file for "
+           << fileName << ": " << ec.message() << "\n";
+    return false;
+  }
+  {
+    raw_fd_ostream file(fd, true);
+    file << buffer << this->sectionsBuffer;
+    file.close();
+    if (file.has_error()) {
+      errs() << writerName << ": cannot write " << temporaryFileName << ": "
+             << file.error().message() << "\n";
+      file.clear_error();
+      sys::fs::remove(temporaryFileName);
+      return false;
+    }
+  }
+  ec = sys::fs::rename(temporaryFileName, fileName);
+  if (ec) {
+    errs() << writerName << ": cannot write " << fileName << ": "
+           << ec.message() << "\n";
+    sys::fs::remove(temporaryFileName);
+    return false;
+  }
+
+  return true;
+}
+
+} // namespace arcana::noelle
@@ -0,0 +1,261 @@
+/*
+ * Copyright 2024  Simone Campanoni
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "llvm/Support/xxhash.h"
+#include "arcana/noelle/core/IRHash.hpp"
+
+namespace arcana::noelle {
+
+uint64_t IRHash::hashString(StringRef s) {
+  return xxHash64(s);
+}
+
+uint64_t IRHash::hashWords(std::vector<uint64_t> const &words) {
+  auto bytes = reinterpret_cast<const uint8_t *>(words.data());
+  return xxHash64(ArrayRef<uint8_t>(bytes, words.size() * sizeof(uint64_t)));
+}
+
+static uint64_t hashType(Type *t, DenseMap<Type *, uint64_t> &hashes) {
+
+  /*
+   * Types are hashed structurally, so a change of layout (e.g., of the fields
+   * of a struct) changes the hash even if the name of the type does not.
+   * Structs can refer to themselves through pointers: the entry is set before
+   * visiting the contained types to stop the recursion.
+   */
+  auto it = hashes.find(t);
+  if (it != hashes.end()) {
+    return it->second;
+  }
+  hashes[t] = t->getTypeID();
+  std::vector<uint64_t> words{ t->getTypeID() };
+  if (auto intType = dyn_cast<IntegerType>(t)) {
+    words.push_back(intType->getBitWidth());
+  } else if (auto ptrType = dyn_cast<PointerType>(t)) {
+    words.push_back(ptrType->getAddressSpace());
+    if (!ptrType->isOpaque()) {
+      words.push_back(
+          hashType(ptrType->getNonOpaquePointerElementType(), hashes));
+    }
+  } else if (auto structType = dyn_cast<StructType>(t)) {
+    words.push_back(structType->isPacked());
+    words.push_back(structType->isOpaque());
+    for (auto elementType : structType->elements()) {
+      words.push_back(hashType(elementType, hashes));
+    }
+  } else if (auto arrayType = dyn_cast<ArrayType>(t)) {
+    words.push_back(arrayType->getNumElements());
+    words.push_back(hashType(arrayType->getElementType(), hashes));
+  } else if (auto vectorType = dyn_cast<VectorType>(t)) {
+    auto elementCount = vectorType->getElementCount();
+    words.push_back(elementCount.getKnownMinValue());
+    words.push_back(elementCount.isScalable());
+    words.push_back(hashType(vectorType->getElementType(), hashes));
+  } else if (auto functionType = dyn_cast<FunctionType>(t)) {
+    words.push_back(functionType->isVarArg());
+    for (auto containedType : functionType->subtypes()) {
+      words.push_back(hashType(containedType, hashes));
+    }
+  }
+  auto h = IRHash::hashWords(words);
+  hashes[t] = h;
+
+  return h;
+}
+
+static uint64_t hashMetadata(Metadata *md,
+                             DenseMap<const MDNode *, uint64_t> &hashes) {
+  if (md == nullptr) {
+    return 0;
+  }
+  if (auto str = dyn_cast<MDString>(md)) {
+    return IRHash::hashString(str->getString());
+  }
+  if (auto c = dyn_cast<ConstantAsMetadata>(md)) {
+    if (auto ci = dyn_cast<ConstantInt>(c->getValue())) {
+      return ci->getLimitedValue();
+    }
+    return c->getValue()->getValueID();
+  }
+  auto node = dyn_cast<MDNode>(md);
+  if (node == nullptr) {
+    return md->getMetadataID();
+  }
+
+  /*
+   * Nodes are shared between instructions (e.g., the TBAA type DAG), so their
+   * hash is computed once.
+   * Alias scopes and domains refer to themselves: the entry is set before
+   * visiting the operands to stop the recursion.
+   */
+  auto it = hashes.find(node);
+  if (it != hashes.end()) {
+    return it->second;
+  }
+  hashes[node] = 0;
+  std::vector<uint64_t> words{ node->getNumOperands(), node->isDistinct() };
+  for (auto &operand : node->operands()) {
+    words.push_back(hashMetadata(operand.get(), hashes));
+  }
+  auto h = IRHash::hashWords(words);
+  hashes[node] = h;
+
+  return h;
+}
+
+static void hashAttributes(AttributeList attributes,
+                           std::vector<uint64_t> &words) {
+  for (auto attributeSet : attributes) {
+    words.push_back(IRHash::hashString(attributeSet.getAsString()));
+  }
+
+  return;
+}
+
+uint64_t IRHash::computeFunctionHash(Function &F) {
+  DenseMap<Type *, uint64_t> typeHashes;
+  std::vector<uint64_t> words;
+
+  /*
+   * Hash the signature and the attributes.
+   */
+  words.push_back(IRHash::hashString(F.getName()));
+  words.push_back(F.getLinkage());
+  words.push_back(hashType(F.getReturnType(), typeHashes));
+  for (auto &arg : F.args()) {
+    words.push_back(hashType(arg.getType(), typeHashes));
+  }
+  hashAttributes(F.getAttributes(), words);
+
+  /*
+   * Number the local values.
+   */
+  DenseMap<Value *, uint64_t> localIDs;
+  for (auto &arg : F.args()) {
+    localIDs[&arg] = localIDs.size();
+  }
+  for (auto &bb : F) {
+    localIDs[&bb] = localIDs.size();
+    for (auto &inst : bb) {
+      localIDs[&inst] = localIDs.size();
+    }
+  }
+
+  /*
+   * Hash the instructions, their operands, and the metadata used by the alias
+   * analyses.
+   */
+  static const unsigned aliasAnalysisMetadata[] = {
+    LLVMContext::MD_tbaa,        LLVMContext::MD_tbaa_struct,
+    LLVMContext::MD_alias_scope, LLVMContext::MD_noalias,
+    LLVMContext::MD_invariant_load
+  };
+  DenseMap<const MDNode *, uint64_t> metadataHashes;
+  for (auto &bb : F) {
+    words.push_back(bb.size());
+    for (auto &inst : bb) {
+      words.push_back(inst.getOpcode());
+      words.push_back(hashType(inst.getType(), typeHashes));
+      words.push_back(inst.getNumOperands());
+      if (auto cmpInst = dyn_cast<CmpInst>(&inst)) {
+        words.push_back(cmpInst->getPredicate());
+      } else if (auto loadInst = dyn_cast<LoadInst>(&inst)) {
+        words.push_back(loadInst->isVolatile());
+      } else if (auto storeInst = dyn_cast<StoreInst>(&inst)) {
+        words.push_back(storeInst->isVolatile());
+      } else if (auto allocaInst = dyn_cast<AllocaInst>(&inst)) {
+        words.push_back(hashType(allocaInst->getAllocatedType(), typeHashes));
+      } else if (auto gep = dyn_cast<GetElementPtrInst>(&inst)) {
+        words.push_back(hashType(gep->getSourceElementType(), typeHashes));
+      } else if (auto phi = dyn_cast<PHINode>(&inst)) {
+        for (auto incomingBB : phi->blocks()) {
+          words.push_back(localIDs[incomingBB]);
+        }
+      } else if (auto callInst = dyn_cast<CallBase>(&inst)) {
+        words.push_back(hashType(callInst->getFunctionType(), typeHashes));
+        hashAttributes(callInst->getAttributes(), words);
+      }
+      for (auto &operand : inst.operands()) {
+        auto v = operand.get();
+        words.push_back(hashType(v->getType(), typeHashes));
+        auto it = localIDs.find(v);
+        if (it != localIDs.end()) {
+          words.push_back(it->second);
+        } else if (auto g = dyn_cast<GlobalValue>(v)) {
+          words.push_back(IRHash::hashString(g->getName()));
+          words.push_back(hashType(g->getValueType(), typeHashes));
+        } else if (auto c = dyn_cast<ConstantInt>(v)) {
+          words.push_back(hash_value(c->getValue()));
+        } else if (auto c = dyn_cast<Constant>(v)) {
+          std::string s;
+          raw_string_ostream cs(s);
+          c->print(cs);
+          words.push_back(IRHash::hashString(cs.str()));
+        } else {
+          words.push_back(v->getValueID());
+        }
+      }
+      if (inst.hasMetadataOtherThanDebugLoc()) {
+        for (auto kind : aliasAnalysisMetadata) {
+          words.push_back(hashMetadata(inst.getMetadata(kind), metadataHashes));
+        }
+      }
+    }
+  }
+
+  return IRHash::hashWords(words);
+}
+
+uint64_t IRHash::computeGlobalsHash(Module &M) {
+  DenseMap<Type *, uint64_t> typeHashes;
+  std::vector<uint64_t> words;
+
+  /*
+   * Hash the data layout, which fixes the size and the offsets of the types.
+   */
+  words.push_back(IRHash::hashString(M.getDataLayoutStr()));
+
+  /*
+   * Hash the global variables.
+   */
+  for (auto &g : M.globals()) {
+    words.push_back(IRHash::hashString(g.getName()));
+    words.push_back(g.getLinkage());
+    words.push_back(g.isConstant());
+    words.push_back(g.hasInitializer());
+    words.push_back(hashType(g.getValueType(), typeHashes));
+  }
+
+  /*
+   * Hash the function declarations.
+   */
+  for (auto &F : M) {
+    if (!F.isDeclaration()) {
+      continue;
+    }
+    words.push_back(IRHash::hashString(F.getName()));
+    hashAttributes(F.getAttributes(), words);
+  }
+
+  return IRHash::hashWords(words);
+}
+
+} // namespace arcana::noelle
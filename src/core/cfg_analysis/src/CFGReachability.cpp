@@ -0,0 +1,243 @@
+/*
+ * Copyright 2024  Simone Campanoni
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "arcana/noelle/core/CFGReachability.hpp"
+
+namespace arcana::noelle {
+
+CFGReachability::CFGReachability(Function &f, BasicBlock *header)
+  : header{ header } {
+
+  /*
+   * Condense the CFG.
+   */
+  this->computeComponents(f);
+
+  /*
+   * The reachable components are computed on demand.
+   */
+  auto numberOfComponents = this->isCyclic.size();
+  this->reachableComponents.resize(numberOfComponents);
+  this->isReachabilityComputed.resize(numberOfComponents, false);
+
+  return;
+}
+
+bool CFGReachability::canReach(BasicBlock *from, BasicBlock *to) {
+  assert(this->componentOf.count(from) > 0);
+  assert(this->componentOf.count(to) > 0);
+
+  /*
+   * A basic block can reach the basic blocks of its own component only if the
+   * component includes a cycle.
+   */
+  auto fromComponent = this->componentOf[from];
+  auto toComponent = this->componentOf[to];
+  if (fromComponent == toComponent) {
+    return this->isCyclic[fromComponent];
+  }
+
+  return this->getReachableComponents(fromComponent).test(toComponent);
+}
+
+bool CFGReachability::canReach(Instruction *from, Instruction *to) {
+
+  /*
+   * Instructions of the same basic block are ordered by their position in it.
+   */
+  auto fromBB = from->getParent();
+  auto toBB = to->getParent();
+  if ((fromBB == toBB) && (from != to) && from->comesBefore(to)) {
+    return true;
+  }
+
+  /*
+   * @to can be executed after @from only if the execution goes through a
+   * (possibly empty) sequence of basic blocks that leads back to @toBB.
+   */
+  return this->canReach(fromBB, toBB);
+}
+
+bool CFGReachability::isEdgeIncluded(BasicBlock *to) const {
+  return (this->header == nullptr) || (to != this->header);
+}
+
+void CFGReachability::computeComponents(Function &f) {
+
+  /*
+   * Number the basic blocks.
+   */
+  std::vector<BasicBlock *> blocks;
+  DenseMap<BasicBlock *, uint32_t> blockIDs;
+  for (auto &bb : f) {
+    blockIDs[&bb] = blocks.size();
+    blocks.push_back(&bb);
+  }
+
+  /*
+   * Identify the strongly connected components with Tarjan's algorithm.
+   *
+   * Components are identified in reverse topological order, so the
+   * successors of a component always have smaller IDs than it.
+   */
+  auto n = blocks.size();
+  const uint32_t notVisited = std::numeric_limits<uint32_t>::max();
+  std::vector<uint32_t> index(n, notVisited);
+  std::vector<uint32_t> lowLink(n, 0);
+  std::vector<bool> isOnStack(n, false);
+  std::vector<uint32_t> stack;
+  std::vector<std::pair<uint32_t, succ_iterator>> dfsStack;
+  uint32_t nextIndex = 0;
+  auto visit = [&](uint32_t id) {
+    index[id] = nextIndex;
+    lowLink[id] = nextIndex;
+    nextIndex++;
+    stack.push_back(id);
+    isOnStack[id] = true;
+    dfsStack.push_back({ id, succ_begin(blocks[id]) });
+  };
+  for (auto root = 0u; root < n; root++) {
+    if (index[root] != notVisited) {
+      continue;
+    }
+    visit(root);
+
+    while (!dfsStack.empty()) {
+      auto id = dfsStack.back().first;
+      auto &succIt = dfsStack.back().second;
+
+      /*
+       * Visit the next successor of the current basic block.
+       */
+      if (succIt != succ_end(blocks[id])) {
+        auto succ = *succIt;
+        ++succIt;
+        if (!this->isEdgeIncluded(succ)) {
+          continue;
+        }
+        auto succID = blockIDs[succ];
+        if (index[succID] == notVisited) {
+          visit(succID);
+        } else if (isOnStack[succID]) {
+          lowLink[id] = std::min(lowLink[id], index[succID]);
+        }
+        continue;
+      }
+
+      /*
+       * All successors have been visited.
+       */
+      dfsStack.pop_back();
+      if (!dfsStack.empty()) {
+        auto parentID = dfsStack.back().first;
+        lowLink[parentID] = std::min(lowLink[parentID], lowLink[id]);
+      }
+      if (lowLink[id] != index[id]) {
+        continue;
+      }
+
+      /*
+       * The current basic block is the root of a component.
+       */
+      auto component = this->isCyclic.size();
+      auto componentSize = 0u;
+      while (true) {
+        auto memberID = stack.back();
+        stack.pop_back();
+        isOnStack[memberID] = false;
+        this->componentOf[blocks[memberID]] = component;
+        componentSize++;
+        if (memberID == id) {
+          break;
+        }
+      }
+      this->isCyclic.push_back(componentSize > 1);
+    }
+  }
+
+  /*
+   * Add the edges between components.
+   * A component with a single basic block is cyclic if that block jumps to
+   * itself.
+   */
+  this->componentSuccessors.resize(this->isCyclic.size());
+  for (auto bb : blocks) {
+    auto component = this->componentOf[bb];
+    for (auto succ : successors(bb)) {
+      if (!this->isEdgeIncluded(succ)) {
+        continue;
+      }
+      auto succComponent = this->componentOf[succ];
+      if (succComponent == component) {
+        this->isCyclic[component] = true;
+        continue;
+      }
+      this->componentSuccessors[component].push_back(succComponent);
+    }
+  }
+  for (auto &succComponents : this->componentSuccessors) {
+    std::sort(succComponents.begin(), succComponents.end());
+    succComponents.erase(
+        std::unique(succComponents.begin(), succComponents.end()),
+        succComponents.end());
+  }
+
+  return;
+}
+
+const BitVector &CFGReachability::getReachableComponents(uint32_t component) {
+
+  /*
+   * Compute the components reachable from the successors of @component
+   * first. This never loops because components form a DAG.
+   */
+  std::vector<uint32_t> toCompute{ component };
+  while (!toCompute.empty()) {
+    auto current = toCompute.back();
+    if (this->isReachabilityComputed[current]) {
+      toCompute.pop_back();
+      continue;
+    }
+    auto areSuccessorsComputed = true;
+    for (auto succComponent : this->componentSuccessors[current]) {
+      if (!this->isReachabilityComputed[succComponent]) {
+        toCompute.push_back(succComponent);
+        areSuccessorsComputed = false;
+      }
+    }
+    if (!areSuccessorsComputed) {
+      continue;
+    }
+    toCompute.pop_back();
+
+    BitVector reachable(this->isCyclic.size());
+    for (auto succComponent : this->componentSuccessors[current]) {
+      reachable.set(succComponent);
+      reachable |= this->reachableComponents[succComponent];
+    }
+    this->reachableComponents[current] = std::move(reachable);
+    this->isReachabilityComputed[current] = true;
+  }
+
+  return this->reachableComponents[component];
+}
+
+} // namespace arcana::noelle
@@ -0,0 +1,217 @@
+/*
+ * Copyright 2024  Simone Campanoni
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifndef NOELLE_SRC_CORE_DATAFLOW_BITVECTORDATAFLOWENGINE_H_
+#define NOELLE_SRC_CORE_DATAFLOW_BITVECTORDATAFLOWENGINE_H_
+
+#include "arcana/noelle/core/SystemHeaders.hpp"
+#include "arcana/noelle/core/BitVectorDataFlowResult.hpp"
+#include "arcana/noelle/core/StaticDataFlowEngine.hpp"
+
+namespace arcana::noelle {
+
+/*
+ * Engine for data-flow analyses whose transfer functions have the form
+ * OUT = GEN U (IN - KILL) and whose meet operator is the set union.
+ *
+ * The fixed point is computed per basic block: the GEN and KILL sets of the
+ * instructions of a basic block are composed once and every iteration of the
+ * engine updates the IN/OUT sets of basic blocks with word-wise operations.
+ *
+ * GEN, KILL and the edge filter are template parameters, so none of them goes
+ * through a type-erased call.
+ */
+class BitVectorDataFlowEngine {
+public:
+  BitVectorDataFlowEngine() = default;
+
+  template <typename GENFunction, typename KILLFunction>
+  BitVectorDataFlowResult *applyForward(Function *f,
+                                        std::vector<Value *> const &universe,
+                                        GENFunction computeGEN,
+                                        KILLFunction computeKILL) {
+    return this->applyForward(f,
+                              universe,
+                              computeGEN,
+                              computeKILL,
+                              [](BasicBlock *, BasicBlock *) { return true; });
+  }
+
+  /*
+   * Values flow through the CFG edge from -> to only if
+   * isEdgeIncluded(from, to) returns true.
+   */
+  template <typename GENFunction, typename KILLFunction, typename EdgeFilter>
+  BitVectorDataFlowResult *applyForward(Function *f,
+                                        std::vector<Value *> const &universe,
+                                        GENFunction computeGEN,
+                                        KILLFunction computeKILL,
+                                        EdgeFilter isEdgeIncluded) {
+    return BitVectorDataFlowEngine::apply<true>(f,
+                                                universe,
+                                                computeGEN,
+                                                computeKILL,
+                                                isEdgeIncluded);
+  }
+
+  template <typename GENFunction, typename KILLFunction>
+  BitVectorDataFlowResult *applyBackward(Function *f,
+                                         std::vector<Value *> const &universe,
+                                         GENFunction computeGEN,
+                                         KILLFunction computeKILL) {
+    return this->applyBackward(f,
+                               universe,
+                               computeGEN,
+                               computeKILL,
+                               [](BasicBlock *, BasicBlock *) { return true; });
+  }
+
+  template <typename GENFunction, typename KILLFunction, typename EdgeFilter>
+  BitVectorDataFlowResult *applyBackward(Function *f,
+                                         std::vector<Value *> const &universe,
+                                         GENFunction computeGEN,
+                                         KILLFunction computeKILL,
+                                         EdgeFilter isEdgeIncluded) {
+    return BitVectorDataFlowEngine::apply<false>(f,
+                                                 universe,
+                                                 computeGEN,
+                                                 computeKILL,
+                                                 isEdgeIncluded);
+  }
+
+private:
+  /*
+   * Policy of StaticDataFlowEngine for GEN/KILL analyses.
+   */
+  template <bool IsForward, typename EdgeFilter>
+  class GENKILLAnalysis {
+  public:
+    using Domain = BitVector;
+    static constexpr bool isForward = IsForward;
+
+    GENKILLAnalysis(uint32_t numberOfValues, EdgeFilter &edgeFilter)
+      : numberOfValues{ numberOfValues },
+        edgeFilter{ edgeFilter } {
+      return;
+    }
+
+    BitVector getInitialValue(BasicBlock *) {
+      return BitVector(this->numberOfValues);
+    }
+
+    bool isEdgeIncluded(BasicBlock *from, BasicBlock *to) {
+      return this->edgeFilter(from, to);
+    }
+
+    void meet(BitVector &value, const BitVector &incoming) {
+      value |= incoming;
+      return;
+    }
+
+    void transfer(BasicBlock *bb, const BitVector &entry, BitVector &exit) {
+      exit = entry;
+      exit.reset(this->blockKILLs[bb]);
+      exit |= this->blockGENs[bb];
+      return;
+    }
+
+    DenseMap<BasicBlock *, BitVector> blockGENs;
+    DenseMap<BasicBlock *, BitVector> blockKILLs;
+
+  private:
+    uint32_t numberOfValues;
+    EdgeFilter &edgeFilter;
+  };
+
+  template <bool IsForward,
+            typename GENFunction,
+            typename KILLFunction,
+            typename EdgeFilter>
+  static BitVectorDataFlowResult *apply(Function *f,
+                                        std::vector<Value *> const &universe,
+                                        GENFunction &computeGEN,
+                                        KILLFunction &computeKILL,
+                                        EdgeFilter &isEdgeIncluded) {
+    assert(f != nullptr);
+    auto df = new BitVectorDataFlowResult(f, universe, IsForward);
+    auto n = universe.size();
+
+    /*
+     * Compute the GENs and KILLs of the instructions.
+     */
+    for (auto &inst : instructions(*f)) {
+      computeGEN(&inst, df);
+      computeKILL(&inst, df);
+    }
+
+    /*
+     * Compose the GENs and KILLs of the instructions of each basic block
+     * following the direction of the analysis.
+     *
+     * GEN[bb] = GEN[i] U (GEN[bb] - KILL[i])
+     * KILL[bb] = KILL[bb] U KILL[i]
+     */
+    GENKILLAnalysis<IsForward, EdgeFilter> analysis(n, isEdgeIncluded);
+    for (auto &bb : *f) {
+      BitVector gen(n);
+      BitVector kill(n);
+      auto compose = [df, &gen, &kill](Instruction *inst) {
+        df->applyTransferFunction(inst, gen);
+        for (auto valueID : df->KILL(inst)) {
+          kill.set(valueID);
+        }
+      };
+      if (IsForward) {
+        for (auto &inst : bb) {
+          compose(&inst);
+        }
+      } else {
+        for (auto it = bb.rbegin(); it != bb.rend(); ++it) {
+          compose(&*it);
+        }
+      }
+      analysis.blockGENs[&bb] = std::move(gen);
+      analysis.blockKILLs[&bb] = std::move(kill);
+    }
+
+    /*
+     * Compute the fixed point.
+     */
+    StaticDataFlowEngine<GENKILLAnalysis<IsForward, EdgeFilter>> engine(
+        *f,
+        analysis);
+    engine.apply();
+
+    /*
+     * Store the IN and OUT sets of the basic blocks.
+     */
+    for (auto &bb : *f) {
+      df->IN(&bb) = std::move(engine.IN(&bb));
+      df->OUT(&bb) = std::move(engine.OUT(&bb));
+    }
+
+    return df;
+  }
+};
+
+} // namespace arcana::noelle
+
+#endif // NOELLE_SRC_CORE_DATAFLOW_BITVECTORDATAFLOWENGINE_H_
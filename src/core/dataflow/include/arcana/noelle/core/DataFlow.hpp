@@ -24,6 +24,9 @@
 
 #include "arcana/noelle/core/SystemHeaders.hpp"
 
+#include "arcana/noelle/core/BitVectorDataFlowResult.hpp"
+#include "arcana/noelle/core/StaticDataFlowEngine.hpp"
+#include "arcana/noelle/core/BitVectorDataFlowEngine.hpp"
 #include "arcana/noelle/core/DataFlowResult.hpp"
 #include "arcana/noelle/core/DataFlowEngine.hpp"
 #include "arcana/noelle/core/DataFlowAnalysis.hpp"
@@ -23,6 +23,7 @@
 #define NOELLE_SRC_CORE_DATAFLOW_DATAFLOWRESULT_H_
 
 #include "arcana/noelle/core/SystemHeaders.hpp"
+#include "arcana/noelle/core/BitVectorDataFlowResult.hpp"
 
 namespace arcana::noelle {
 
@@ -33,16 +34,33 @@ public:
    */
   DataFlowResult();
 
+  /*
+   * Adapter of @bitVectorResult, which is now owned by "this".
+   * The sets of an instruction are materialized the first time they are
+   * requested.
+   */
+  DataFlowResult(BitVectorDataFlowResult *bitVectorResult);
+
+  DataFlowResult(const DataFlowResult &) = delete;
+
   std::set<Value *> &GEN(Instruction *inst);
   std::set<Value *> &KILL(Instruction *inst);
   std::set<Value *> &IN(Instruction *inst);
   std::set<Value *> &OUT(Instruction *inst);
 
+  /*
+   * Return the bit-vector result "this" is an adapter of, if any.
+   */
+  BitVectorDataFlowResult *getBitVectorResult(void) const;
+
+  ~DataFlowResult();
+
 private:
   std::map<Instruction *, std::set<Value *>> gens;
   std::map<Instruction *, std::set<Value *>> kills;
   std::map<Instruction *, std::set<Value *>> ins;
   std::map<Instruction *, std::set<Value *>> outs;
+  BitVectorDataFlowResult *bitVectorResult;
 };
 
 } // namespace arcana::noelle
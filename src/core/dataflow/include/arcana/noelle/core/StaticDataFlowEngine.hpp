@@ -0,0 +1,242 @@
+/*
+ * Copyright 2024  Simone Campanoni
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifndef NOELLE_SRC_CORE_DATAFLOW_STATICDATAFLOWENGINE_H_
+#define NOELLE_SRC_CORE_DATAFLOW_STATICDATAFLOWENGINE_H_
+
+#include "llvm/ADT/PostOrderIterator.h"
+#include "arcana/noelle/core/SystemHeaders.hpp"
+
+namespace arcana::noelle {
+
+/*
+ * Data-flow engine whose analysis is described by the policy type @Analysis.
+ * Every operation of the analysis is resolved at compile time, so the
+ * transfer and the meet functions can be inlined in the loop that computes the
+ * fixed point.
+ *
+ * @Analysis must provide:
+ *
+ *   using Domain = ...;
+ *     Type of the data-flow values (e.g., BitVector).
+ *
+ *   static constexpr bool isForward = ...;
+ *     Direction of the analysis.
+ *
+ *   Domain getInitialValue(BasicBlock *bb);
+ *     Value that both the entry and the exit of @bb start from.
+ *
+ *   bool isEdgeIncluded(BasicBlock *from, BasicBlock *to);
+ *     Whether values flow through the CFG edge @from -> @to.
+ *
+ *   void meet(Domain &value, const Domain &incoming);
+ *     Merge @incoming into @value.
+ *
+ *   void transfer(BasicBlock *bb, const Domain &entry, Domain &exit);
+ *     Compute the exit of @bb given its entry.
+ *
+ * The entry of a basic block is its IN set for forward analyses and its OUT
+ * set for backward ones (and vice versa for the exit).
+ */
+template <typename Analysis>
+class StaticDataFlowEngine {
+public:
+  using Domain = typename Analysis::Domain;
+
+  StaticDataFlowEngine(Function &f, Analysis &analysis)
+    : f{ f },
+      analysis{ analysis } {
+    return;
+  }
+
+  StaticDataFlowEngine() = delete;
+
+  /*
+   * Compute the fixed point of the analysis.
+   */
+  void apply(void) {
+    constexpr bool isForward = Analysis::isForward;
+
+    /*
+     * Number the basic blocks following the reverse post-order of the
+     * direction of the analysis.
+     * This is also the order the working list starts from, which reduces the
+     * number of iterations needed to reach the fixed point.
+     */
+    this->blocks.clear();
+    this->blockIDs.clear();
+    auto addBlock = [this](BasicBlock *bb) {
+      if (this->blockIDs.count(bb) > 0) {
+        return;
+      }
+      this->blockIDs[bb] = this->blocks.size();
+      this->blocks.push_back(bb);
+    };
+    if (isForward) {
+      ReversePostOrderTraversal<Function *> rpot(&this->f);
+      for (auto bb : rpot) {
+        addBlock(bb);
+      }
+    } else {
+      for (auto bb : post_order(&this->f)) {
+        addBlock(bb);
+      }
+    }
+    for (auto &bb : this->f) {
+      addBlock(&bb);
+    }
+
+    /*
+     * Initialize the data-flow values.
+     */
+    auto n = this->blocks.size();
+    this->entries.clear();
+    this->exits.clear();
+    if (n == 0) {
+      return;
+    }
+    this->entries.reserve(n);
+    this->exits.reserve(n);
+    for (auto bb : this->blocks) {
+      this->entries.push_back(this->analysis.getInitialValue(bb));
+      this->exits.push_back(this->analysis.getInitialValue(bb));
+    }
+
+    /*
+     * Create the working list.
+     */
+    std::deque<uint32_t> workingList;
+    std::vector<bool> isInWorkingList(n, true);
+    for (auto i = 0u; i < n; i++) {
+      workingList.push_back(i);
+    }
+
+    /*
+     * Compute the fixed point.
+     */
+    Domain newExit = this->analysis.getInitialValue(this->blocks[0]);
+    while (!workingList.empty()) {
+      auto id = workingList.front();
+      workingList.pop_front();
+      isInWorkingList[id] = false;
+      auto bb = this->blocks[id];
+
+      /*
+       * Meet the values coming from the predecessors (successors for backward
+       * analyses) of @bb.
+       */
+      auto &entry = this->entries[id];
+      if (isForward) {
+        for (auto predBB : predecessors(bb)) {
+          if (!this->analysis.isEdgeIncluded(predBB, bb)) {
+            continue;
+          }
+          this->analysis.meet(entry, this->exits[this->blockIDs[predBB]]);
+        }
+      } else {
+        for (auto succBB : successors(bb)) {
+          if (!this->analysis.isEdgeIncluded(bb, succBB)) {
+            continue;
+          }
+          this->analysis.meet(entry, this->exits[this->blockIDs[succBB]]);
+        }
+      }
+
+      /*
+       * Apply the transfer function of @bb.
+       */
+      this->analysis.transfer(bb, entry, newExit);
+
+      /*
+       * Check if the exit changed.
+       */
+      auto &exit = this->exits[id];
+      if (newExit == exit) {
+        continue;
+      }
+      std::swap(exit, newExit);
+
+      /*
+       * Propagate the change.
+       */
+      auto appendBB = [this, &workingList, &isInWorkingList](BasicBlock *other) {
+        auto otherID = this->blockIDs[other];
+        if (isInWorkingList[otherID]) {
+          return;
+        }
+        isInWorkingList[otherID] = true;
+        workingList.push_back(otherID);
+      };
+      if (isForward) {
+        for (auto succBB : successors(bb)) {
+          if (this->analysis.isEdgeIncluded(bb, succBB)) {
+            appendBB(succBB);
+          }
+        }
+      } else {
+        for (auto predBB : predecessors(bb)) {
+          if (this->analysis.isEdgeIncluded(predBB, bb)) {
+            appendBB(predBB);
+          }
+        }
+      }
+    }
+
+    return;
+  }
+
+  /*
+   * Values at the entry and at the exit of @bb.
+   * They are valid only after the fixed point has been computed.
+   */
+  Domain &getEntry(BasicBlock *bb) {
+    assert(this->blockIDs.count(bb) > 0);
+    return this->entries[this->blockIDs[bb]];
+  }
+
+  Domain &getExit(BasicBlock *bb) {
+    assert(this->blockIDs.count(bb) > 0);
+    return this->exits[this->blockIDs[bb]];
+  }
+
+  /*
+   * Values at the IN and at the OUT of @bb.
+   */
+  Domain &IN(BasicBlock *bb) {
+    return Analysis::isForward ? this->getEntry(bb) : this->getExit(bb);
+  }
+
+  Domain &OUT(BasicBlock *bb) {
+    return Analysis::isForward ? this->getExit(bb) : this->getEntry(bb);
+  }
+
+private:
+  Function &f;
+  Analysis &analysis;
+  std::vector<BasicBlock *> blocks;
+  DenseMap<BasicBlock *, uint32_t> blockIDs;
+  std::vector<Domain> entries;
+  std::vector<Domain> exits;
+};
+
+} // namespace arcana::noelle
+
+#endif // NOELLE_SRC_CORE_DATAFLOW_STATICDATAFLOWENGINE_H_
@@ -0,0 +1,200 @@
+/*
+ * Copyright 2024  Simone Campanoni
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "arcana/noelle/core/BitVectorDataFlowResult.hpp"
+
+namespace arcana::noelle {
+
+BitVectorDataFlowResult::BitVectorDataFlowResult(
+    Function *f,
+    std::vector<Value *> const &universe,
+    bool isForward)
+  : f{ f },
+    forward{ isForward },
+    values{ universe } {
+  assert(f != nullptr);
+
+  /*
+   * Number the values.
+   */
+  for (auto i = 0u; i < this->values.size(); i++) {
+    this->valueIDs[this->values[i]] = i;
+  }
+
+  /*
+   * Allocate the sets of the basic blocks.
+   */
+  auto n = this->values.size();
+  for (auto &bb : *f) {
+    this->blockINs[&bb] = BitVector(n);
+    this->blockOUTs[&bb] = BitVector(n);
+  }
+
+  return;
+}
+
+Function *BitVectorDataFlowResult::getFunction(void) const {
+  return this->f;
+}
+
+bool BitVectorDataFlowResult::isForward(void) const {
+  return this->forward;
+}
+
+uint32_t BitVectorDataFlowResult::getNumberOfValues(void) const {
+  return this->values.size();
+}
+
+bool BitVectorDataFlowResult::isInUniverse(Value *v) const {
+  return this->valueIDs.find(v) != this->valueIDs.end();
+}
+
+uint32_t BitVectorDataFlowResult::getValueID(Value *v) const {
+  auto it = this->valueIDs.find(v);
+  assert(it != this->valueIDs.end());
+
+  return it->second;
+}
+
+Value *BitVectorDataFlowResult::getValue(uint32_t valueID) const {
+  assert(valueID < this->values.size());
+
+  return this->values[valueID];
+}
+
+void BitVectorDataFlowResult::addToGEN(Instruction *inst, Value *v) {
+  this->gens[inst].push_back(this->getValueID(v));
+
+  return;
+}
+
+void BitVectorDataFlowResult::addToKILL(Instruction *inst, Value *v) {
+  this->kills[inst].push_back(this->getValueID(v));
+
+  return;
+}
+
+ArrayRef<uint32_t> BitVectorDataFlowResult::GEN(Instruction *inst) const {
+  auto it = this->gens.find(inst);
+  if (it == this->gens.end()) {
+    return {};
+  }
+
+  return it->second;
+}
+
+ArrayRef<uint32_t> BitVectorDataFlowResult::KILL(Instruction *inst) const {
+  auto it = this->kills.find(inst);
+  if (it == this->kills.end()) {
+    return {};
+  }
+
+  return it->second;
+}
+
+BitVector &BitVectorDataFlowResult::IN(BasicBlock *bb) {
+  auto it = this->blockINs.find(bb);
+  assert(it != this->blockINs.end());
+
+  return it->second;
+}
+
+BitVector &BitVectorDataFlowResult::OUT(BasicBlock *bb) {
+  auto it = this->blockOUTs.find(bb);
+  assert(it != this->blockOUTs.end());
+
+  return it->second;
+}
+
+const BitVector &BitVectorDataFlowResult::IN(Instruction *inst) {
+  auto bb = inst->getParent();
+  if (this->blocksWithInstructionSets.find(bb)
+      == this->blocksWithInstructionSets.end()) {
+    this->computeInstructionSets(bb);
+  }
+
+  return this->ins[inst];
+}
+
+const BitVector &BitVectorDataFlowResult::OUT(Instruction *inst) {
+  auto bb = inst->getParent();
+  if (this->blocksWithInstructionSets.find(bb)
+      == this->blocksWithInstructionSets.end()) {
+    this->computeInstructionSets(bb);
+  }
+
+  return this->outs[inst];
+}
+
+void BitVectorDataFlowResult::applyTransferFunction(Instruction *inst,
+                                                    BitVector &set) const {
+
+  /*
+   * set = GEN[inst] U (set - KILL[inst])
+   */
+  for (auto valueID : this->KILL(inst)) {
+    set.reset(valueID);
+  }
+  for (auto valueID : this->GEN(inst)) {
+    set.set(valueID);
+  }
+
+  return;
+}
+
+std::set<Value *> BitVectorDataFlowResult::toSet(const BitVector &set) const {
+  std::set<Value *> s;
+  for (auto valueID : set.set_bits()) {
+    s.insert(this->values[valueID]);
+  }
+
+  return s;
+}
+
+void BitVectorDataFlowResult::computeInstructionSets(BasicBlock *bb) {
+  this->blocksWithInstructionSets.insert(bb);
+
+  /*
+   * Walk the basic block following the direction of the analysis starting
+   * from the set at its boundary.
+   */
+  if (this->forward) {
+    auto current = this->IN(bb);
+    for (auto &inst : *bb) {
+      this->ins[&inst] = current;
+      this->applyTransferFunction(&inst, current);
+      this->outs[&inst] = current;
+    }
+
+  } else {
+    auto current = this->OUT(bb);
+    for (auto it = bb->rbegin(); it != bb->rend(); ++it) {
+      auto inst = &*it;
+      this->outs[inst] = current;
+      this->applyTransferFunction(inst, current);
+      this->ins[inst] = current;
+    }
+  }
+
+  return;
+}
+
+} // namespace arcana::noelle
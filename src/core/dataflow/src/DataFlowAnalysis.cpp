@@ -46,15 +46,29 @@ DataFlowResult *DataFlowAnalysis::runReachableAnalysis(
     Function *f,
     std::function<bool(Instruction *i)> filter) {
 
+  /*
+   * Only instructions that pass the filter can be reached.
+   * So they are the universe of the analysis.
+   */
+  std::vector<Value *> universe;
+  for (auto &inst : instructions(*f)) {
+    if (filter(&inst)) {
+      universe.push_back(&inst);
+    }
+  }
+
   /*
    * Allocate the engine
    */
-  auto dfa = DataFlowEngine{};
+  auto dfa = BitVectorDataFlowEngine{};
 
   /*
    * Define the data-flow equations
+   *
+   * IN[i] = GEN[i] U OUT[i]
+   * OUT[i] = U IN[s], for every successor s of i
    */
-  auto computeGEN = [filter](Instruction *i, DataFlowResult *df) {
+  auto computeGEN = [filter](Instruction *i, BitVectorDataFlowResult *df) {
     /*
      * Check if the instruction should be considered.
      */
@@ -65,40 +79,18 @@ DataFlowResult *DataFlowAnalysis::runReachableAnalysis(
     /*
      * Add the instruction to the GEN set.
      */
-    auto &gen = df->GEN(i);
-    gen.insert(i);
+    df->addToGEN(i, i);
 
     return;
   };
-  auto computeKILL = [](Instruction *, DataFlowResult *) { return; };
-  auto computeOUT = [](Instruction *inst,
-                       Instruction *succ,
-                       std::set<Value *> &OUT,
-                       DataFlowResult *df) {
-    auto &inS = df->IN(succ);
-    OUT.insert(inS.begin(), inS.end());
-    return;
-  };
-  auto computeIN =
-      [](Instruction *inst, std::set<Value *> &IN, DataFlowResult *df) {
-        auto &genI = df->GEN(inst);
-        auto &outI = df->OUT(inst);
-
-        /*
-         * IN[i] = GEN[i] U OUT[i]
-         */
-        IN.insert(genI.begin(), genI.end());
-        IN.insert(outI.begin(), outI.end());
-
-        return;
-      };
+  auto computeKILL = [](Instruction *, BitVectorDataFlowResult *) { return; };
 
   /*
    * Run the data flow analysis needed to identify the instructions that could
    * be executed from a given point.
    */
-  auto df =
-      dfa.applyBackward(f, computeGEN, computeKILL, computeIN, computeOUT);
+  auto bvdf = dfa.applyBackward(f, universe, computeGEN, computeKILL);
+  auto df = new DataFlowResult(bvdf);
 
   return df;
 }
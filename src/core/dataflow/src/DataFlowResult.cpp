@@ -23,32 +23,101 @@
 
 namespace arcana::noelle {
 
-DataFlowResult::DataFlowResult() {
+DataFlowResult::DataFlowResult() : bitVectorResult{ nullptr } {
+  return;
+}
+
+DataFlowResult::DataFlowResult(BitVectorDataFlowResult *bitVectorResult)
+  : bitVectorResult{ bitVectorResult } {
+  assert(this->bitVectorResult != nullptr);
+
   return;
 }
 
 std::set<Value *> &DataFlowResult::GEN(Instruction *inst) {
+  if (this->bitVectorResult == nullptr) {
+    return this->gens[inst];
+  }
+
+  /*
+   * Materialize the set from the bit-vector result.
+   */
+  auto it = this->gens.find(inst);
+  if (it != this->gens.end()) {
+    return it->second;
+  }
   auto &s = this->gens[inst];
+  for (auto valueID : this->bitVectorResult->GEN(inst)) {
+    s.insert(this->bitVectorResult->getValue(valueID));
+  }
 
   return s;
 }
 
 std::set<Value *> &DataFlowResult::KILL(Instruction *inst) {
+  if (this->bitVectorResult == nullptr) {
+    return this->kills[inst];
+  }
+
+  /*
+   * Materialize the set from the bit-vector result.
+   */
+  auto it = this->kills.find(inst);
+  if (it != this->kills.end()) {
+    return it->second;
+  }
   auto &s = this->kills[inst];
+  for (auto valueID : this->bitVectorResult->KILL(inst)) {
+    s.insert(this->bitVectorResult->getValue(valueID));
+  }
 
   return s;
 }
 
 std::set<Value *> &DataFlowResult::IN(Instruction *inst) {
+  if (this->bitVectorResult == nullptr) {
+    return this->ins[inst];
+  }
+
+  /*
+   * Materialize the set from the bit-vector result.
+   */
+  auto it = this->ins.find(inst);
+  if (it != this->ins.end()) {
+    return it->second;
+  }
   auto &s = this->ins[inst];
+  s = this->bitVectorResult->toSet(this->bitVectorResult->IN(inst));
 
   return s;
 }
 
 std::set<Value *> &DataFlowResult::OUT(Instruction *inst) {
+  if (this->bitVectorResult == nullptr) {
+    return this->outs[inst];
+  }
+
+  /*
+   * Materialize the set from the bit-vector result.
+   */
+  auto it = this->outs.find(inst);
+  if (it != this->outs.end()) {
+    return it->second;
+  }
   auto &s = this->outs[inst];
+  s = this->bitVectorResult->toSet(this->bitVectorResult->OUT(inst));
 
   return s;
 }
 
+BitVectorDataFlowResult *DataFlowResult::getBitVectorResult(void) const {
+  return this->bitVectorResult;
+}
+
+DataFlowResult::~DataFlowResult() {
+  delete this->bitVectorResult;
+
+  return;
+}
+
 } // namespace arcana::noelle
@@ -67,6 +67,17 @@ public:
   virtual bool canThisDependenceBeLoopCarried(DGEdge<Value, Value> *dep,
                                               LoopStructure &loop);
 
+  /*
+   * Check if the verdicts of the analysis about the instructions of a
+   * function only depend on the code of that function.
+   * This is false by default: analyses that look at other functions (e.g.,
+   * whole-program alias analyses) can change their verdicts when those
+   * functions change.
+   * Only the verdicts of intraprocedural analyses are cached by
+   * DependenceAnalysisDispatcher.
+   */
+  virtual bool isIntraprocedural(void) const;
+
   virtual ~DependenceAnalysis();
 
 private:
@@ -78,6 +78,10 @@ bool DependenceAnalysis::canThisDependenceBeLoopCarried(
   return true;
 }
 
+bool DependenceAnalysis::isIntraprocedural(void) const {
+  return false;
+}
+
 DependenceAnalysis::~DependenceAnalysis() {}
 
 } // namespace arcana::noelle
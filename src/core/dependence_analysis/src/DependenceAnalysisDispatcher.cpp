@@ -0,0 +1,296 @@
+/*
+ * Copyright 2024  Simone Campanoni
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include <chrono>
+#include "arcana/noelle/core/DependenceAnalysisDispatcher.hpp"
+#include "arcana/noelle/core/MustMemoryDependence.hpp"
+
+namespace arcana::noelle {
+
+DependenceAnalysisDispatcher::DependenceAnalysisDispatcher() {
+  return;
+}
+
+void DependenceAnalysisDispatcher::addAnalysis(DependenceAnalysis *a) {
+  assert(a != nullptr);
+
+  /*
+   * Each analysis is invoked at most once per query.
+   */
+  if (std::find(this->analyses.begin(), this->analyses.end(), a)
+      != this->analyses.end()) {
+    return;
+  }
+  this->analyses.push_back(a);
+
+  DependenceAnalysisProfile profile;
+  profile.name = a->getName();
+  this->profiles.push_back(profile);
+
+  return;
+}
+
+bool DependenceAnalysisDispatcher::isEmpty(void) const {
+  return this->analyses.empty();
+}
+
+bool DependenceAnalysisDispatcher::canThereBeAMemoryDataDependence(
+    Instruction *fromInst,
+    Instruction *toInst,
+    Function &function) {
+  for (auto i = 0u; i < this->analyses.size(); i++) {
+    auto invoke = [&](DependenceAnalysis *a) -> uint8_t {
+      return a->canThereBeAMemoryDataDependence(fromInst, toInst, function);
+    };
+    Query query{ i, MEMORY_DATA_DEPENDENCE, 0, fromInst, toInst, nullptr };
+    if (!this->getVerdict(nullptr, query, invoke, false)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool DependenceAnalysisDispatcher::canThereBeAMemoryDataDependence(
+    Instruction *fromInst,
+    Instruction *toInst,
+    LoopStructure &loop) {
+  for (auto i = 0u; i < this->analyses.size(); i++) {
+    auto invoke = [&](DependenceAnalysis *a) -> uint8_t {
+      return a->canThereBeAMemoryDataDependence(fromInst, toInst, loop);
+    };
+    Query query{
+      i, MEMORY_DATA_DEPENDENCE, 0, fromInst, toInst, loop.getHeader()
+    };
+    if (!this->getVerdict(loop.getFunction(), query, invoke, false)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+MemoryDataDependenceStrength DependenceAnalysisDispatcher::
+    isThereThisMemoryDataDependenceType(DataDependenceType t,
+                                        Instruction *fromInst,
+                                        Instruction *toInst,
+                                        Function &function) {
+
+  /*
+   * A proof that the dependence does not exist wins over the other verdicts,
+   * so the analyses are queried until one of them proves it.
+   */
+  auto strength = MAY_EXIST;
+  for (auto i = 0u; i < this->analyses.size(); i++) {
+    auto invoke = [&](DependenceAnalysis *a) -> uint8_t {
+      return a->isThereThisMemoryDataDependenceType(t,
+                                                    fromInst,
+                                                    toInst,
+                                                    function);
+    };
+    Query query{
+      i, MEMORY_DATA_DEPENDENCE_TYPE, (uint8_t)t, fromInst, toInst, nullptr
+    };
+    auto verdict = static_cast<MemoryDataDependenceStrength>(
+        this->getVerdict(nullptr, query, invoke, CANNOT_EXIST));
+    if (verdict == CANNOT_EXIST) {
+      return CANNOT_EXIST;
+    }
+    if (verdict == MUST_EXIST) {
+      strength = MUST_EXIST;
+    }
+  }
+
+  return strength;
+}
+
+MemoryDataDependenceStrength DependenceAnalysisDispatcher::
+    isThereThisMemoryDataDependenceType(DataDependenceType t,
+                                        Instruction *fromInst,
+                                        Instruction *toInst,
+                                        LoopStructure &loop) {
+  auto strength = MAY_EXIST;
+  for (auto i = 0u; i < this->analyses.size(); i++) {
+    auto invoke = [&](DependenceAnalysis *a) -> uint8_t {
+      return a->isThereThisMemoryDataDependenceType(t, fromInst, toInst, loop);
+    };
+    Query query{ i,        MEMORY_DATA_DEPENDENCE_TYPE, (uint8_t)t,
+                 fromInst, toInst,                      loop.getHeader() };
+    auto verdict = static_cast<MemoryDataDependenceStrength>(
+        this->getVerdict(loop.getFunction(), query, invoke, CANNOT_EXIST));
+    if (verdict == CANNOT_EXIST) {
+      return CANNOT_EXIST;
+    }
+    if (verdict == MUST_EXIST) {
+      strength = MUST_EXIST;
+    }
+  }
+
+  return strength;
+}
+
+bool DependenceAnalysisDispatcher::canThisDependenceBeLoopCarried(
+    DGEdge<Value, Value> *dep,
+    LoopStructure &loop) {
+
+  /*
+   * Only dependences between instructions are cached.
+   * The kind of the dependence is part of the query because analyses can
+   * answer differently for different kinds.
+   */
+  auto fromInst = dyn_cast<Instruction>(dep->getSrc());
+  auto toInst = dyn_cast<Instruction>(dep->getDst());
+  auto loopFunction = loop.getFunction();
+  if ((fromInst == nullptr) || (toInst == nullptr)) {
+    loopFunction = nullptr;
+  }
+  uint8_t kind = 0;
+  if (auto dataDep = dyn_cast<DataDependence<Value, Value>>(dep)) {
+    kind = 1 + dataDep->getDataDependenceType();
+  }
+  if (isa<MemoryDependence<Value, Value>>(dep)) {
+    kind |= 4;
+  }
+  if (isa<MustMemoryDependence<Value, Value>>(dep)) {
+    kind |= 8;
+  }
+
+  for (auto i = 0u; i < this->analyses.size(); i++) {
+    auto invoke = [&](DependenceAnalysis *a) -> uint8_t {
+      return a->canThisDependenceBeLoopCarried(dep, loop);
+    };
+    Query query{
+      i, LOOP_CARRIED_DEPENDENCE, kind, fromInst, toInst, loop.getHeader()
+    };
+    if (!this->getVerdict(loopFunction, query, invoke, false)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void DependenceAnalysisDispatcher::refreshCache(Function &f) {
+
+  /*
+   * Compute the fingerprint of the instructions of @f: their identity, their
+   * opcodes, and their operands.
+   */
+  size_t fingerprint = hash_value(f.size());
+  for (auto &inst : instructions(f)) {
+    fingerprint = hash_combine(fingerprint, &inst, inst.getOpcode());
+    for (auto &op : inst.operands()) {
+      fingerprint = hash_combine(fingerprint, op.get());
+    }
+  }
+
+  /*
+   * Drop the verdicts about @f if it changed.
+   */
+  auto fingerprintIt = this->fingerprints.find(&f);
+  if ((fingerprintIt != this->fingerprints.end())
+      && (fingerprintIt->second == fingerprint)) {
+    return;
+  }
+  this->fingerprints[&f] = fingerprint;
+  this->verdicts.erase(&f);
+
+  return;
+}
+
+std::vector<DependenceAnalysisProfile> DependenceAnalysisDispatcher::
+    getProfiles(void) const {
+  return this->profiles;
+}
+
+uint8_t DependenceAnalysisDispatcher::getVerdict(
+    Function *loopFunction,
+    const Query &query,
+    std::function<uint8_t(DependenceAnalysis *)> invoke,
+    uint8_t independence) {
+  auto &profile = this->profiles[query.analysisID];
+
+  /*
+   * Check the cache.
+   *
+   * Verdicts about calls depend on the bodies of their callees, and verdicts
+   * of analyses that are not intraprocedural can depend on any function.
+   * Neither is part of the fingerprint of @loopFunction (see refreshCache).
+   * So they are not cached: a transformation of another function would
+   * otherwise leave a stale verdict for an unchanged @loopFunction.
+   */
+  auto analysis = this->analyses[query.analysisID];
+  std::unordered_map<Query, uint8_t, QueryHash> *cache = nullptr;
+  auto involvesCalls = isa_and_nonnull<CallBase>(query.fromInst)
+                       || isa_and_nonnull<CallBase>(query.toInst);
+  if ((loopFunction != nullptr) && !involvesCalls
+      && analysis->isIntraprocedural()) {
+    cache = &this->verdicts[loopFunction];
+    auto verdictIt = cache->find(query);
+    if (verdictIt != cache->end()) {
+      profile.cachedQueries++;
+      if (verdictIt->second == independence) {
+        profile.independences++;
+      }
+      return verdictIt->second;
+    }
+  }
+
+  /*
+   * Invoke the analysis.
+   */
+  auto start = std::chrono::steady_clock::now();
+  auto verdict = invoke(analysis);
+  auto end = std::chrono::steady_clock::now();
+  profile.queries++;
+  profile.seconds += std::chrono::duration<double>(end - start).count();
+  if (verdict == independence) {
+    profile.independences++;
+  }
+
+  /*
+   * Cache the verdict.
+   */
+  if (cache != nullptr) {
+    (*cache)[query] = verdict;
+  }
+
+  return verdict;
+}
+
+bool DependenceAnalysisDispatcher::Query::operator==(const Query &other) const {
+  return (this->analysisID == other.analysisID) && (this->type == other.type)
+         && (this->dependence == other.dependence)
+         && (this->fromInst == other.fromInst) && (this->toInst == other.toInst)
+         && (this->loopHeader == other.loopHeader);
+}
+
+size_t DependenceAnalysisDispatcher::QueryHash::operator()(
+    const Query &q) const {
+  return hash_combine(q.analysisID,
+                      q.type,
+                      q.dependence,
+                      q.fromInst,
+                      q.toInst,
+                      q.loopHeader);
+}
+
+} // namespace arcana::noelle
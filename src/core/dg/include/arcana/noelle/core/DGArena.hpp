@@ -0,0 +1,131 @@
+/*
+ * Copyright 2024  Simone Campanoni
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifndef NOELLE_SRC_CORE_DG_DGARENA_H_
+#define NOELLE_SRC_CORE_DG_DGARENA_H_
+
+#include "arcana/noelle/core/SystemHeaders.hpp"
+#include "llvm/Support/Allocator.h"
+
+namespace arcana::noelle {
+
+/*
+ * Bump allocator that owns the nodes and the edges of a dependence graph.
+ *
+ * Objects are constructed in slabs. Destroying an object only runs its
+ * destructor: its memory is given back when the whole arena is released, which
+ * costs one deallocation per slab.
+ */
+class DGArena {
+public:
+  DGArena();
+
+  DGArena(const DGArena &other) = delete;
+
+  DGArena &operator=(const DGArena &other) = delete;
+
+  /*
+   * Construct an object of type ObjT in the arena.
+   */
+  template <class ObjT, class... ArgTs>
+  ObjT *create(ArgTs &&...args) {
+    auto memory = this->allocator.Allocate(sizeof(ObjT), alignof(ObjT));
+    this->numberOfObjectsAllocated++;
+    this->numberOfLiveObjects++;
+    if (this->numberOfLiveObjects > this->maxNumberOfLiveObjects) {
+      this->maxNumberOfLiveObjects = this->numberOfLiveObjects;
+    }
+    return new (memory) ObjT(std::forward<ArgTs>(args)...);
+  }
+
+  /*
+   * Destroy an object allocated by the arena.
+   */
+  template <class ObjT>
+  void destroy(ObjT *object) {
+    assert(this->numberOfLiveObjects > 0);
+    object->~ObjT();
+    this->numberOfLiveObjects--;
+  }
+
+  /*
+   * Return the number of bytes handed out by the arena.
+   * Memory is never reused, so this is also the high-water mark of the graph.
+   */
+  uint64_t getBytesAllocated(void) const;
+
+  /*
+   * Return the number of bytes reserved by the slabs of the arena.
+   */
+  uint64_t getTotalMemory(void) const;
+
+  /*
+   * Return the number of slabs allocated by the arena.
+   */
+  uint64_t getNumberOfSlabs(void) const;
+
+  uint64_t getNumberOfObjectsAllocated(void) const;
+
+  uint64_t getNumberOfLiveObjects(void) const;
+
+  uint64_t getMaxNumberOfLiveObjects(void) const;
+
+private:
+  BumpPtrAllocator allocator;
+  uint64_t numberOfObjectsAllocated;
+  uint64_t numberOfLiveObjects;
+  uint64_t maxNumberOfLiveObjects;
+};
+
+inline DGArena::DGArena()
+  : numberOfObjectsAllocated{ 0 },
+    numberOfLiveObjects{ 0 },
+    maxNumberOfLiveObjects{ 0 } {
+  return;
+}
+
+inline uint64_t DGArena::getBytesAllocated(void) const {
+  return this->allocator.getBytesAllocated();
+}
+
+inline uint64_t DGArena::getTotalMemory(void) const {
+  return this->allocator.getTotalMemory();
+}
+
+inline uint64_t DGArena::getNumberOfSlabs(void) const {
+  return this->allocator.GetNumSlabs();
+}
+
+inline uint64_t DGArena::getNumberOfObjectsAllocated(void) const {
+  return this->numberOfObjectsAllocated;
+}
+
+inline uint64_t DGArena::getNumberOfLiveObjects(void) const {
+  return this->numberOfLiveObjects;
+}
+
+inline uint64_t DGArena::getMaxNumberOfLiveObjects(void) const {
+  return this->maxNumberOfLiveObjects;
+}
+
+} // namespace arcana::noelle
+
+#endif // NOELLE_SRC_CORE_DG_DGARENA_H_
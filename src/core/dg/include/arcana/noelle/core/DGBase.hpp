@@ -23,6 +23,7 @@
 #define NOELLE_SRC_CORE_DG_DGBASE_H_
 
 #include "arcana/noelle/core/SystemHeaders.hpp"
+#include "arcana/noelle/core/DGArena.hpp"
 #include "arcana/noelle/core/DGNode.hpp"
 #include "arcana/noelle/core/DGEdge.hpp"
 #include "arcana/noelle/core/DataDependence.hpp"
@@ -39,6 +40,10 @@ class DG {
 public:
   DG();
 
+  DG(const DG<T> &other) = delete;
+
+  virtual ~DG();
+
   using nodes_iterator = typename std::set<DGNode<T> *>::iterator;
   using nodes_const_iterator = typename std::set<DGNode<T> *>::const_iterator;
   using edges_iterator = typename std::set<DGEdge<T, T> *>::iterator;
@@ -197,6 +202,11 @@ public:
   static std::vector<DGEdge<T, T> *> sortDependences(
       const std::set<DGEdge<T, T> *> &set);
 
+  /*
+   * Return the arena that owns the nodes and the edges of the graph.
+   */
+  const DGArena &getArena(void) const;
+
 protected:
   int32_t nodeIdCounter;
   std::set<DGNode<T> *> allNodes;
@@ -205,6 +215,7 @@ protected:
   std::map<T *, DGNode<T> *> internalNodeMap;
   std::map<T *, DGNode<T> *> externalNodeMap;
   std::shared_ptr<DepIdReverseMap_t> depLookupMap;
+  DGArena arena;
 };
 
 /*
@@ -217,9 +228,26 @@ DG<T>::DG() : nodeIdCounter{ 0 },
   return;
 }
 
+template <class T>
+DG<T>::~DG() {
+
+  /*
+   * Run the destructors of the nodes and edges still in the graph.
+   * Their memory is released all at once by the arena.
+   */
+  for (auto edge : allEdges) {
+    arena.destroy(edge);
+  }
+  for (auto node : allNodes) {
+    arena.destroy(node);
+  }
+
+  return;
+}
+
 template <class T>
 DGNode<T> *DG<T>::addNode(T *theT, bool inclusion) {
-  auto node = new DGNode<T>(nodeIdCounter++, theT);
+  auto node = arena.template create<DGNode<T>>(nodeIdCounter++, theT);
   allNodes.insert(node);
   auto &map = inclusion ? internalNodeMap : externalNodeMap;
   map[theT] = node;
@@ -279,7 +307,8 @@ DGEdge<T, T> *DG<T>::addVariableDataDependenceEdge(T *from,
                                                    DataDependenceType t) {
   auto fromNode = this->fetchNode(from);
   auto toNode = this->fetchNode(to);
-  auto edge = new VariableDependence<T, T>(fromNode, toNode, t);
+  auto edge =
+      arena.template create<VariableDependence<T, T>>(fromNode, toNode, t);
   allEdges.insert(edge);
   fromNode->addOutgoingEdge(edge);
   toNode->addIncomingEdge(edge);
@@ -295,9 +324,11 @@ DGEdge<T, T> *DG<T>::addMemoryDataDependenceEdge(T *from,
   auto toNode = this->fetchNode(to);
   DGEdge<T, T> *edge = nullptr;
   if (isMust) {
-    edge = new MustMemoryDependence<T, T>(fromNode, toNode, t);
+    edge =
+        arena.template create<MustMemoryDependence<T, T>>(fromNode, toNode, t);
   } else {
-    edge = new MayMemoryDependence<T, T>(fromNode, toNode, t);
+    edge =
+        arena.template create<MayMemoryDependence<T, T>>(fromNode, toNode, t);
   }
   assert(edge != nullptr);
 
@@ -311,7 +342,7 @@ template <class T>
 DGEdge<T, T> *DG<T>::addControlDependenceEdge(T *from, T *to) {
   auto fromNode = this->fetchNode(from);
   auto toNode = this->fetchNode(to);
-  auto edge = new ControlDependence<T, T>(fromNode, toNode);
+  auto edge = arena.template create<ControlDependence<T, T>>(fromNode, toNode);
   allEdges.insert(edge);
   fromNode->addOutgoingEdge(edge);
   toNode->addIncomingEdge(edge);
@@ -322,7 +353,8 @@ template <class T>
 DGEdge<T, T> *DG<T>::addUndefinedDependenceEdge(T *from, T *to) {
   auto fromNode = this->fetchNode(from);
   auto toNode = this->fetchNode(to);
-  auto edge = new UndefinedDependence<T, T>(fromNode, toNode);
+  auto edge =
+      arena.template create<UndefinedDependence<T, T>>(fromNode, toNode);
   allEdges.insert(edge);
   fromNode->addOutgoingEdge(edge);
   toNode->addIncomingEdge(edge);
@@ -348,17 +380,19 @@ DGEdge<T, T> *DG<T>::copyAddEdge(DGEdge<T, T> &edgeToCopy) {
   DGEdge<T, T> *edge = nullptr;
   if (isa<ControlDependence<T, T>>(&edgeToCopy)) {
     auto edgeToCopyAsCD = cast<ControlDependence<T, T>>(&edgeToCopy);
-    edge = new ControlDependence<T, T>(*edgeToCopyAsCD);
+    edge = arena.template create<ControlDependence<T, T>>(*edgeToCopyAsCD);
   } else {
     if (isa<VariableDependence<T, T>>(&edgeToCopy)) {
       auto edgeToCopyAsVD = cast<VariableDependence<T, T>>(&edgeToCopy);
-      edge = new VariableDependence<T, T>(*edgeToCopyAsVD);
+      edge = arena.template create<VariableDependence<T, T>>(*edgeToCopyAsVD);
     } else if (isa<MayMemoryDependence<T, T>>(&edgeToCopy)) {
       auto edgeToCopyAsMD = cast<MayMemoryDependence<T, T>>(&edgeToCopy);
-      edge = new MayMemoryDependence<T, T>(*edgeToCopyAsMD);
+      edge =
+          arena.template create<MayMemoryDependence<T, T>>(*edgeToCopyAsMD);
     } else {
       auto edgeToCopyAsMD = cast<MustMemoryDependence<T, T>>(&edgeToCopy);
-      edge = new MustMemoryDependence<T, T>(*edgeToCopyAsMD);
+      edge =
+          arena.template create<MustMemoryDependence<T, T>>(*edgeToCopyAsMD);
     }
   }
   allEdges.insert(edge);
@@ -547,10 +581,10 @@ void DG<T>::removeNode(DGNode<T> *node) {
     edge->getDstNode()->removeConnectedNode(node);
   for (auto edge : allToAndFromNode) {
     allEdges.erase(edge);
-    delete edge;
+    arena.destroy(edge);
   }
 
-  delete node;
+  arena.destroy(node);
 }
 
 template <class T>
@@ -558,7 +592,7 @@ void DG<T>::removeEdge(DGEdge<T, T> *edge) {
   edge->getSrcNode()->removeConnectedEdge(edge);
   edge->getDstNode()->removeConnectedEdge(edge);
   allEdges.erase(edge);
-  delete edge;
+  arena.destroy(edge);
 }
 
 template <class T>
@@ -680,6 +714,11 @@ std::vector<DGEdge<T, T> *> DG<T>::sortDependences(
   return v;
 }
 
+template <class T>
+const DGArena &DG<T>::getArena(void) const {
+  return arena;
+}
+
 template <class T>
 uint64_t DG<T>::numNodes(void) const {
   return allNodes.size();
@@ -80,6 +80,8 @@ private:
 
   void cloneLLVMNodes(std::set<DTAliases::Node *> &nodesToClone);
 
+  void computeDFSNumbers(void);
+
   void addDescendants(DominatorNode *n, std::set<BasicBlock *> &ds) const;
 };
 
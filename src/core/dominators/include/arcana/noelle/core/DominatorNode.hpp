@@ -41,6 +41,15 @@ public:
   std::vector<DominatorNode *> getChildren(void) const;
   uint32_t getLevel(void) const;
 
+  /*
+   * Return the numbers assigned to the node when a depth-first visit of its
+   * forest enters and exits it.
+   * The node dominates all and only the nodes whose numbers are included in
+   * [getDFSNumberIn(), getDFSNumberOut()].
+   */
+  uint32_t getDFSNumberIn(void) const;
+  uint32_t getDFSNumberOut(void) const;
+
   raw_ostream &print(raw_ostream &stream, std::string prefixToUse = "");
 
   friend class DominatorForest;
@@ -48,6 +57,8 @@ public:
 private:
   BasicBlock *B;
   uint32_t level;
+  uint32_t dfsNumberIn;
+  uint32_t dfsNumberOut;
 
   DominatorNode *parent;
   std::vector<DominatorNode *> children;
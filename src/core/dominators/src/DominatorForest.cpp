@@ -136,6 +136,11 @@ void DominatorForest::cloneLLVMNodes(
     }
   }
 
+  /*
+   * Number the nodes to answer dominance queries in constant time.
+   */
+  this->computeDFSNumbers();
+
   return;
 }
 
@@ -169,6 +174,43 @@ void DominatorForest::cloneNodes(std::set<NodeType *> &nodesToClone) {
       summary->children.push_back(childSummary);
     }
   }
+
+  /*
+   * Number the nodes to answer dominance queries in constant time.
+   */
+  this->computeDFSNumbers();
+}
+
+void DominatorForest::computeDFSNumbers(void) {
+
+  /*
+   * Visit every tree of the forest in depth-first order.
+   * A node is numbered when the visit enters it and when it exits it, so the
+   * numbers of its descendants are included between its own ones.
+   */
+  uint32_t dfsNumber = 0;
+  std::vector<std::pair<DominatorNode *, bool>> stack;
+  for (auto root : this->nodes) {
+    if (root->parent != nullptr) {
+      continue;
+    }
+    stack.push_back(std::make_pair(root, false));
+    while (!stack.empty()) {
+      auto [node, isExiting] = stack.back();
+      stack.pop_back();
+      if (isExiting) {
+        node->dfsNumberOut = dfsNumber++;
+        continue;
+      }
+      node->dfsNumberIn = dfsNumber++;
+      stack.push_back(std::make_pair(node, true));
+      for (auto child : node->children) {
+        stack.push_back(std::make_pair(child, false));
+      }
+    }
+  }
+
+  return;
 }
 
 DominatorNode *DominatorForest::getNode(BasicBlock *B) const {
@@ -186,56 +228,21 @@ bool DominatorForest::dominates(Instruction *I, Instruction *J) const {
   if (B1 == B2) {
 
     /*
-     * Define the first and second instruction.
+     * Check if J is found after I.
+     * The order of the instructions within a basic block is cached by LLVM and
+     * it is recomputed only when the basic block changes, so this check takes
+     * constant (amortized) time.
      */
-    auto firstOne = I;
-    auto secondOne = J;
-
-    /*
-     * Check the dominance relation between I and J
-     */
-    while (firstOne != nullptr) {
-      if (firstOne == secondOne) {
-
-        /*
-         * The secondOne instruction is found after the first one.
-         * Hence, I dominates J.
-         * Also, J postdominates I.
-         */
-        if (this->post) {
-
-          /*
-           * I does not post-dominate J.
-           */
-          return false;
-        }
-
-        /*
-         * I dominates J
-         */
-        return true;
-      }
-
-      firstOne = firstOne->getNextNode();
-    }
+    auto isJAfterI = (I == J) || I->comesBefore(J);
 
     /*
-     * The secondOne instruction has not been found after the first one.
-     * Hence, J dominates I.
-     * Also, I post-dominates J.
+     * If J is found after I, then I dominates J.
+     * Also, J postdominates I (but I does not post-dominate J).
      */
     if (this->post) {
-
-      /*
-       * I post-dominates J.
-       */
-      return true;
+      return !isJAfterI;
     }
-
-    /*
-     * I does not dominates J.
-     */
-    return false;
+    return isJAfterI;
   }
 
   /*
@@ -275,20 +282,13 @@ bool DominatorForest::strictlyDominates(BasicBlock *B1, BasicBlock *B2) const {
 
 bool DominatorForest::dominates(DominatorNode *node1,
                                 DominatorNode *node2) const {
-  std::queue<DominatorNode *> worklist;
-  worklist.push(node1);
-  while (!worklist.empty()) {
-    auto node = worklist.front();
-    worklist.pop();
-
-    if (node == node2) {
-      return true;
-    }
-    for (auto child : node->children)
-      worklist.push(child);
-  }
 
-  return false;
+  /*
+   * @node1 dominates @node2 if and only if @node2 has been visited while
+   * visiting the sub-tree rooted at @node1.
+   */
+  return (node1->dfsNumberIn <= node2->dfsNumberIn)
+         && (node2->dfsNumberOut <= node1->dfsNumberOut);
 }
 
 std::set<DominatorNode *> DominatorForest::dominates(
@@ -418,19 +418,11 @@ DominatorNode *DominatorForest::findNearestCommonDominator(
     DominatorNode *node1,
     DominatorNode *node2) const {
 
-  /*
-   * Helpers to determine whether a node n dominates node2
-   */
-  auto dominatorsOf2 = this->dominates(node2);
-  auto dominates2 = [&](DominatorNode *node) -> bool {
-    return dominatorsOf2.find(node) != dominatorsOf2.end();
-  };
-
   /*
    * Traversal of parents of node1 to find common dominator
    */
   DominatorNode *node = node1;
-  while (node && !dominates2(node))
+  while (node && !this->dominates(node, node2))
     node = node->parent;
   return node;
 }
@@ -27,15 +27,34 @@
 #include "arcana/noelle/core/SystemHeaders.hpp"
 #include "arcana/noelle/core/LoopStructure.hpp"
 #include "arcana/noelle/core/SCC.hpp"
+#include "arcana/noelle/core/HotProfileCache.hpp"
 
 namespace arcana::noelle {
 
+/*
+ * Profiles of the program.
+ *
+ * The profile of a function is loaded the first time it is needed: from the
+ * profile cache (see HotProfileCache) if it stores the function as it is now,
+ * or from the block frequencies of the function otherwise.
+ * Counters of the whole module (e.g., the coverage) load all functions.
+ */
 class Hot {
 public:
   Hot(Module &M,
       std::function<llvm::BlockFrequencyInfo &(Function &F)> getBFI,
       std::function<llvm::BranchProbabilityInfo &(Function &F)> getBPI);
 
+  /*
+   * @profileCacheFileName is the profile cache to use ("" to disable it).
+   * The cache is updated once all functions are loaded if some of them were
+   * missing or out of date.
+   */
+  Hot(Module &M,
+      std::function<llvm::BlockFrequencyInfo &(Function &F)> getBFI,
+      std::function<llvm::BranchProbabilityInfo &(Function &F)> getBPI,
+      std::string profileCacheFileName);
+
   bool isAvailable(void) const;
 
   /*
@@ -167,36 +186,59 @@ public:
   double getBranchFrequency(BasicBlock *sourceBB, BasicBlock *targetBB) const;
 
 private:
-  std::unordered_map<BasicBlock *, std::unordered_map<BasicBlock *, double>>
+  Module &M;
+  mutable std::unordered_map<BasicBlock *,
+                             std::unordered_map<BasicBlock *, double>>
       branchProbability;
-  std::unordered_map<BasicBlock *, uint64_t> bbInvocations;
-  std::unordered_map<Function *, uint64_t> functionInvocations;
-  std::unordered_map<Function *, uint64_t> functionSelfInstructions;
-  std::unordered_map<Function *, uint64_t> functionTotalInstructions;
-  std::unordered_map<Instruction *, uint64_t> instructionTotalInstructions;
-  uint64_t moduleNumberOfInstructionsExecuted;
+  mutable std::unordered_map<BasicBlock *, uint64_t> bbInvocations;
+  mutable std::unordered_map<Function *, uint64_t> functionInvocations;
+  mutable std::unordered_map<Function *, uint64_t> functionSelfInstructions;
+  mutable std::unordered_map<Function *, uint64_t> functionTotalInstructions;
+  mutable std::unordered_map<Function *, uint64_t> functionIDs;
+  mutable std::unordered_map<Instruction *, uint64_t>
+      instructionTotalInstructions;
+  mutable uint64_t moduleNumberOfInstructionsExecuted;
   std::function<llvm::BlockFrequencyInfo &(Function &F)> getBFI;
   std::function<llvm::BranchProbabilityInfo &(Function &F)> getBPI;
+  std::string profileCacheFileName;
+  std::unique_ptr<HotProfileCache> profileCache;
+
+  /*
+   * What has been loaded or computed so far.
+   */
+  mutable std::unordered_set<Function *> functionsWithProfile;
+  mutable std::unordered_set<Function *> functionsWithBranchProfile;
+  mutable std::unordered_set<Function *>
+      functionsWithDistributedTotalInstructions;
+  mutable bool areModuleCountersAvailable;
+  mutable bool isProfileCacheStale;
+
+  void loadProfile(Function &F) const;
+
+  void loadBranchProfile(Function &F) const;
+
+  void computeModuleCounters(void) const;
 
-  void computeTotalInstructions(Module &M);
+  void computeTotalInstructionsOfCallees(Function &F) const;
 
   void computeTotalInstructions(
       Function &F,
-      std::unordered_map<Function *, bool> &evaluationStack);
+      std::unordered_map<Function *, bool> &evaluationStack) const;
 
-  void setFunctionTotalInstructions(Function *f, uint64_t totalInstructions);
+  uint64_t getFunctionID(Function &F) const;
+
+  void distributeTotalInstructionsAmongCallers(Function &F) const;
+
+  void setFunctionTotalInstructions(Function *f,
+                                    uint64_t totalInstructions) const;
 
   bool isFunctionTotalInstructionsAvailable(Function &F) const;
 
-  void setBasicBlockInvocations(BasicBlock *bb, uint64_t invocations);
+  void setBasicBlockInvocations(BasicBlock *bb, uint64_t invocations) const;
 
   void setBranchFrequency(BasicBlock *src,
                           BasicBlock *dst,
-                          double branchFrequency);
-
-  void computeProgramInvocations(Module &M);
-
-  void analyzeProfiles(Module &M);
+                          double branchFrequency) const;
 };
 
 } // namespace arcana::noelle
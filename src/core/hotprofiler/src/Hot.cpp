@@ -27,81 +27,135 @@ namespace arcana::noelle {
 Hot::Hot(Module &M,
          std::function<llvm::BlockFrequencyInfo &(Function &F)> getBFI,
          std::function<llvm::BranchProbabilityInfo &(Function &F)> getBPI)
-  : moduleNumberOfInstructionsExecuted{ 0 },
+  : Hot(M, getBFI, getBPI, "") {
+  return;
+}
+
+Hot::Hot(Module &M,
+         std::function<llvm::BlockFrequencyInfo &(Function &F)> getBFI,
+         std::function<llvm::BranchProbabilityInfo &(Function &F)> getBPI,
+         std::string profileCacheFileName)
+  : M{ M },
+    moduleNumberOfInstructionsExecuted{ 0 },
     getBFI{ getBFI },
-    getBPI{ getBPI } {
+    getBPI{ getBPI },
+    profileCacheFileName{ profileCacheFileName },
+    profileCache{ nullptr },
+    areModuleCountersAvailable{ false },
+    isProfileCacheStale{ false } {
 
   /*
-   * Analyze the profiles.
+   * Profiles are loaded on demand.
+   * Map the profile cache if it has been requested.
    */
-  this->analyzeProfiles(M);
+  if (this->profileCacheFileName != "") {
+    this->profileCache =
+        std::make_unique<HotProfileCache>(this->profileCacheFileName);
+  }
 
   return;
 }
 
-void Hot::analyzeProfiles(Module &M) {
+void Hot::loadProfile(Function &F) const {
 
   /*
-   * Fetch the invocations of each basic block of each function.
+   * Check if the profile of @F has been loaded already.
    */
-  for (auto &F : M) {
-    if (F.empty()) {
-      continue;
-    }
-    auto &bfi = this->getBFI(F);
-    auto &bpi = this->getBPI(F);
+  if (F.empty()) {
+    return;
+  }
+  if (this->functionsWithProfile.count(&F) > 0) {
+    return;
+  }
+  this->functionsWithProfile.insert(&F);
+
+  /*
+   * Fetch the invocations of the basic blocks from the profile cache.
+   */
+  std::vector<uint64_t> invocations;
+  if ((this->profileCache == nullptr)
+      || (!this->profileCache->getBasicBlockInvocations(F, invocations))) {
 
     /*
-     * Set the invocations of basic blocks.
+     * The profile cache does not have them.
+     * Fetch them from the block frequencies.
      */
+    auto &bfi = this->getBFI(F);
+    invocations.clear();
     for (auto &bb : F) {
 
       /*
        * Check if the basic block has been executed at least once.
        */
-      if (!bfi.getBlockProfileCount(&bb).hasValue()) {
+      auto count = bfi.getBlockProfileCount(&bb);
+      if (!count.hasValue()) {
 
         /*
          * The basic block hasn't been executed.
          */
-        this->setBasicBlockInvocations(&bb, 0);
+        invocations.push_back(0);
         continue;
       }
+      invocations.push_back(count.getValue());
+    }
+    this->isProfileCacheStale = true;
+  }
 
-      /*
-       * Fetch the basic block counter.
-       */
-      auto v = bfi.getBlockProfileCount(&bb).getValue();
+  /*
+   * Set the invocations of the basic blocks.
+   * Compute the total number of instructions executed by @F.
+   * Each call instructions is considered one; so callee instructions are not
+   * considered.
+   */
+  uint64_t selfInstructions = 0;
+  auto bbID = 0u;
+  for (auto &bb : F) {
+    auto bbInvocations = invocations[bbID++];
+    this->setBasicBlockInvocations(&bb, bbInvocations);
+    selfInstructions += (bbInvocations * this->getStaticInstructions(&bb));
+  }
+  this->functionSelfInstructions[&F] = selfInstructions;
 
-      /*
-       * Set the invocations.
-       */
-      this->setBasicBlockInvocations(&bb, v);
+  return;
+}
 
-      /*
-       * Compute the frequency of jumping to the successors of bb.
-       */
-      for (auto succBB : successors(&bb)) {
-        auto prob = bpi.getEdgeProbability(&bb, succBB);
-        if (prob.isUnknown()) {
-          continue;
-        }
-        auto probNum = double(prob.getNumerator());
-        auto probDen = double(prob.getDenominator());
-        auto probValue = probNum / probDen;
+void Hot::loadBranchProfile(Function &F) const {
 
-        /*
-         * Set the frequency.
-         */
-        this->setBranchFrequency(&bb, succBB, probValue);
-      }
-    }
+  /*
+   * Check if the branch probabilities of @F have been loaded already.
+   */
+  if (F.empty()) {
+    return;
   }
+  if (this->functionsWithBranchProfile.count(&F) > 0) {
+    return;
+  }
+  this->functionsWithBranchProfile.insert(&F);
 
   /*
-   * Compute the global counters.
+   * Compute the frequency of jumping to the successors of the basic blocks
+   * that have been executed.
    */
-  this->computeProgramInvocations(M);
+  auto &bpi = this->getBPI(F);
+  for (auto &bb : F) {
+    if (!this->hasBeenExecuted(&bb)) {
+      continue;
+    }
+    for (auto succBB : successors(&bb)) {
+      auto prob = bpi.getEdgeProbability(&bb, succBB);
+      if (prob.isUnknown()) {
+        continue;
+      }
+      auto probNum = double(prob.getNumerator());
+      auto probDen = double(prob.getDenominator());
+      auto probValue = probNum / probDen;
+
+      /*
+       * Set the frequency.
+       */
+      this->setBranchFrequency(&bb, succBB, probValue);
+    }
+  }
 
   return;
 }
@@ -110,190 +164,247 @@ bool Hot::isAvailable(void) const {
   return this->hasBeenExecuted();
 }
 
-void Hot::computeProgramInvocations(Module &M) {
+void Hot::computeModuleCounters(void) const {
+  if (this->areModuleCountersAvailable) {
+    return;
+  }
+  this->areModuleCountersAvailable = true;
 
   /*
    * Compute the total number of instructions executed.
    */
-  for (auto pairs : this->bbInvocations) {
-
-    /*
-     * Fetch the current basic block
-     */
-    auto bb = pairs.first;
-
-    /*
-     * Fetch the number of invocations of the basic block and its length.
-     */
-    auto totalBBInsts = this->getInvocations(bb);
-    auto bbLength = this->getStaticInstructions(bb);
-
-    /*
-     * Update the module counter
-     */
-    this->moduleNumberOfInstructionsExecuted += (totalBBInsts * bbLength);
+  for (auto &F : this->M) {
+    if (F.empty()) {
+      continue;
+    }
+    this->loadProfile(F);
+    this->moduleNumberOfInstructionsExecuted +=
+        this->functionSelfInstructions.at(&F);
   }
 
   /*
-   * Compute the total number of instructions executed by each function.
-   * Each call instructions is considered one; so callee instructions are not
-   * considered.
+   * All functions are loaded now.
+   * Store them in the profile cache if some of them were not there.
    */
-  for (auto pairs : this->functionInvocations) {
+  if ((this->profileCacheFileName != "") && this->isProfileCacheStale) {
+    HotProfileCache::write(this->M,
+                           this->bbInvocations,
+                           this->profileCacheFileName);
+    this->isProfileCacheStale = false;
+  }
 
-    /*
-     * Fetch the function.
-     */
-    auto f = pairs.first;
+  return;
+}
 
-    /*
-     * Consider all basic blocks.
-     */
-    uint64_t c = 0;
-    for (auto &bb : *f) {
-      auto totalBBInsts =
-          (this->getInvocations(&bb) * this->getStaticInstructions(&bb));
-      c += totalBBInsts;
-    }
-    this->functionSelfInstructions[f] = c;
-  }
+void Hot::distributeTotalInstructionsAmongCallers(Function &F) const {
 
   /*
-   * Compute the total instructions.
+   * Check if we have already distributed the total instructions of @F.
    */
-  this->computeTotalInstructions(M);
+  if (F.empty()) {
+    return;
+  }
+  if (this->functionsWithDistributedTotalInstructions.count(&F) > 0) {
+    return;
+  }
+  this->functionsWithDistributedTotalInstructions.insert(&F);
 
-  return;
-}
+  /*
+   * Check if the function has been executed at all.
+   */
+  if (!this->hasBeenExecuted(&F)) {
+    return;
+  }
 
-void Hot::computeTotalInstructions(Module &moduleToAnalyze) {
+  /*
+   * Fetch the total instructions executed by this function.
+   */
+  auto totalInstsOfF = this->getTotalInstructions(&F);
+  assert(this->isFunctionTotalInstructionsAvailable(F));
+  auto totalInstsOfFPerInvocation = totalInstsOfF / this->getInvocations(&F);
+  auto totalInstsOfFLeftover = totalInstsOfF;
 
   /*
-   * Analyze every function included in M and compute their total instructions
-   * executed.
-   *
-   * To do so, we iterate over all functions of M.
+   * Fetch all callers of the function.
    */
-  for (auto &F : moduleToAnalyze) {
+  Instruction *callerOfF = nullptr;
+  for (auto &useOfF : F.uses()) {
 
     /*
-     * Fetch the next function defined within the module.
+     * Fetch the next call instruction to F.
      */
-    if (F.empty()) {
+    auto userOfF = useOfF.getUser();
+    if (!isa<CallBase>(userOfF)) {
+      continue;
+    }
+    callerOfF = cast<Instruction>(userOfF);
+
+    /*
+     * The instruction "userOfF" invokes F.
+     *
+     * Check if the caller has been executed at all.
+     */
+    if (!this->hasBeenExecuted(callerOfF)) {
       continue;
     }
 
     /*
-     * Compute the total instructions of F.
+     * Compute the fraction of the callee that is associated to the specific
+     * call instruction we are analyzying. To this end, we make the assumption
+     * that the distribution of total instructions of the callee is uniform
+     * among its invocations.
+     *
+     * The total number of instructions executed by this call is the call
+     * itself plus the total instructions executed by the callee divided by
+     * its invocations due to this call.
+     */
+    auto instructionInvocations = this->getInvocations(callerOfF);
+    auto calleeTotalInstsFraction =
+        totalInstsOfFPerInvocation * instructionInvocations;
+    this->instructionTotalInstructions[callerOfF] =
+        calleeTotalInstsFraction + 1;
+
+    /*
+     * Remove the current fraction used of the callee.
+     * This is needed to make sure the whole set of instructions of the callee
+     * will be distributed among the callers.
      */
-    std::unordered_map<Function *, bool> evaluationStack;
-    this->computeTotalInstructions(F, evaluationStack);
+    totalInstsOfFLeftover -= calleeTotalInstsFraction;
   }
 
   /*
-   * Analyze every call instruction.
+   * Check if all the total instructions have been distributed among the
+   * callers.
+   */
+  if (true && (totalInstsOfFLeftover > 0)
+      && (callerOfF != nullptr) /* This handle the case where a function has
+                                   not known callers  */
+  ) {
+
+    /*
+     * There is some leftover to still distribute.
+     * This happen when the total instructions of the callee is not a multiple
+     * of the number of the callers.
+     *
+     * Our heuristic is to give the leftover to the last caller (this is
+     * completely arbitrary).
+     */
+    this->instructionTotalInstructions[callerOfF] += totalInstsOfFLeftover;
+  }
+
+  return;
+}
+
+void Hot::computeTotalInstructionsOfCallees(Function &F) const {
+
+  /*
+   * The total instructions of a function depend on the ones of its callees.
+   * When the call graph has a cycle, the evaluation of the total instructions
+   * has to break it by considering the cost of one of its functions to be 1.
+   * To make the result independent of the order functions are queried, we
+   * evaluate the strongly connected components of the call graph reachable
+   * from @F in post-order (i.e., callees first) and we always enter a
+   * component from its first function in the module.
    *
-   * To do so, we iterate over all functions and check all of their callers.
+   * Only functions that have not been evaluated yet are considered.
+   * Components are identified by following Tarjan's algorithm.
    */
-  for (auto &F : moduleToAnalyze) {
+  uint32_t nextIndex = 0;
+  std::unordered_map<Function *, uint32_t> index;
+  std::unordered_map<Function *, uint32_t> lowLink;
+  std::vector<Function *> stack;
+  std::unordered_set<Function *> onStack;
+  std::function<void(Function &)> visit;
+  visit = [&](Function &G) {
+    index[&G] = nextIndex;
+    lowLink[&G] = nextIndex;
+    nextIndex++;
+    stack.push_back(&G);
+    onStack.insert(&G);
 
     /*
-     * Fetch the next function defined within the module.
+     * Visit the callees that have not been evaluated yet.
      */
-    if (F.empty()) {
-      continue;
+    for (auto &inst : instructions(&G)) {
+      auto callInst = dyn_cast<CallBase>(&inst);
+      if (callInst == nullptr) {
+        continue;
+      }
+      auto callee = callInst->getCalledFunction();
+      if ((callee == nullptr) || (callee->empty())) {
+        continue;
+      }
+      if (this->isFunctionTotalInstructionsAvailable(*callee)) {
+        continue;
+      }
+      if (index.find(callee) == index.end()) {
+        visit(*callee);
+        lowLink[&G] = std::min(lowLink[&G], lowLink[callee]);
+      } else if (onStack.find(callee) != onStack.end()) {
+        lowLink[&G] = std::min(lowLink[&G], index[callee]);
+      }
     }
 
     /*
-     * Check if the function has been executed at all.
+     * Check if @G is the root of a component.
      */
-    if (!this->hasBeenExecuted(&F)) {
-      continue;
+    if (lowLink[&G] != index[&G]) {
+      return;
     }
 
     /*
-     * Fetch the total instructions executed by this function.
+     * Pop the component.
      */
-    assert(this->isFunctionTotalInstructionsAvailable(F));
-    auto totalInstsOfF = this->getTotalInstructions(&F);
-    auto totalInstsOfFPerInvocation = totalInstsOfF / this->getInvocations(&F);
-    auto totalInstsOfFLeftover = totalInstsOfF;
+    std::vector<Function *> component;
+    Function *member = nullptr;
+    do {
+      member = stack.back();
+      stack.pop_back();
+      onStack.erase(member);
+      component.push_back(member);
+    } while (member != &G);
 
     /*
-     * Fetch all callers of the function.
+     * Evaluate the component from its first function in the module.
+     * All callees outside the component have been evaluated already.
      */
-    Instruction *callerOfF = nullptr;
-    for (auto &useOfF : F.uses()) {
-
-      /*
-       * Fetch the next call instruction to F.
-       */
-      auto userOfF = useOfF.getUser();
-      if (!isa<CallBase>(userOfF)) {
-        continue;
-      }
-      callerOfF = cast<Instruction>(userOfF);
-
-      /*
-       * The instruction "userOfF" invokes F.
-       *
-       * Check if the caller has been executed at all.
-       */
-      if (!this->hasBeenExecuted(callerOfF)) {
+    std::sort(component.begin(),
+              component.end(),
+              [this](Function *f0, Function *f1) {
+                return this->getFunctionID(*f0) < this->getFunctionID(*f1);
+              });
+    for (auto f : component) {
+      if (this->isFunctionTotalInstructionsAvailable(*f)) {
         continue;
       }
-
-      /*
-       * Compute the fraction of the callee that is associated to the specific
-       * call instruction we are analyzying. To this end, we make the assumption
-       * that the distribution of total instructions of the callee is uniform
-       * among its invocations.
-       *
-       * The total number of instructions executed by this call is the call
-       * itself plus the total instructions executed by the callee divided by
-       * its invocations due to this call.
-       */
-      auto instructionInvocations = this->getInvocations(callerOfF);
-      auto calleeTotalInstsFraction =
-          totalInstsOfFPerInvocation * instructionInvocations;
-      this->instructionTotalInstructions[callerOfF] =
-          calleeTotalInstsFraction + 1;
-
-      /*
-       * Remove the current fraction used of the callee.
-       * This is needed to make sure the whole set of instructions of the callee
-       * will be distributed among the callers.
-       */
-      totalInstsOfFLeftover -= calleeTotalInstsFraction;
+      std::unordered_map<Function *, bool> evaluationStack;
+      this->computeTotalInstructions(*f, evaluationStack);
     }
+  };
+  visit(F);
 
-    /*
-     * Check if all the total instructions have been distributed among the
-     * callers.
-     */
-    if (true && (totalInstsOfFLeftover > 0)
-        && (callerOfF != nullptr) /* This handle the case where a function has
-                                     not known callers  */
-    ) {
+  return;
+}
 
-      /*
-       * There is some leftover to still distribute.
-       * This happen when the total instructions of the callee is not a multiple
-       * of the number of the callers.
-       *
-       * Our heuristic is to give the leftover to the last caller (this is
-       * completely arbitrary).
-       */
-      this->instructionTotalInstructions[callerOfF] += totalInstsOfFLeftover;
+uint64_t Hot::getFunctionID(Function &F) const {
+
+  /*
+   * Number the functions following their order in the module.
+   */
+  if (this->functionIDs.empty()) {
+    uint64_t nextID = 0;
+    for (auto &G : this->M) {
+      this->functionIDs[&G] = nextID;
+      nextID++;
     }
   }
 
-  return;
+  return this->functionIDs.at(&F);
 }
 
 void Hot::computeTotalInstructions(
     Function &F,
-    std::unordered_map<Function *, bool> &evaluationStack) {
+    std::unordered_map<Function *, bool> &evaluationStack) const {
 
   /*
    * Keep track we are evaluating the input function.
@@ -0,0 +1,154 @@
+/*
+ * Copyright 2024  Simone Campanoni
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "llvm/Support/LEB128.h"
+#include "arcana/noelle/core/IRHash.hpp"
+#include "arcana/noelle/core/HotProfileCache.hpp"
+
+namespace arcana::noelle {
+
+const char HotProfileCache::magic[8] = { 'N', 'O', 'E', 'L',
+                                         'L', 'E', 'H', 'T' };
+
+const uint32_t HotProfileCache::version = 1;
+
+HotProfileCache::HotProfileCache(const std::string &fileName)
+  : file{ fileName, HotProfileCache::magic, HotProfileCache::version, 0 } {
+  return;
+}
+
+bool HotProfileCache::isValid(void) const {
+  return this->file.isValid();
+}
+
+bool HotProfileCache::getBasicBlockInvocations(
+    Function &F,
+    std::vector<uint64_t> &invocations) const {
+
+  /*
+   * Fetch the section of @F and check it is up to date.
+   */
+  auto section = this->file.getSection(F.getName());
+  if (section == nullptr) {
+    return false;
+  }
+  if (section->hash != HotProfileCache::computeFunctionHash(F)) {
+    return false;
+  }
+
+  /*
+   * Decode the invocations.
+   */
+  auto p = section->begin;
+  auto end = section->end;
+  const char *error = nullptr;
+  auto next = [&p, end, &error]() -> uint64_t {
+    unsigned n = 0;
+    auto value = decodeULEB128(p, &n, end, &error);
+    p += n;
+    return value;
+  };
+  auto numberOfBasicBlocks = next();
+  if ((error != nullptr) || (numberOfBasicBlocks != F.size())) {
+    return false;
+  }
+  invocations.clear();
+  invocations.reserve(numberOfBasicBlocks);
+  for (auto i = 0u; (i < numberOfBasicBlocks) && (error == nullptr); i++) {
+    invocations.push_back(next());
+  }
+  if (error != nullptr) {
+    return false;
+  }
+
+  return true;
+}
+
+bool HotProfileCache::write(
+    Module &M,
+    const std::unordered_map<BasicBlock *, uint64_t> &bbInvocations,
+    const std::string &fileName) {
+
+  /*
+   * Encode the sections of the functions.
+   */
+  FunctionSectionsFileWriter writer(HotProfileCache::magic,
+                                    HotProfileCache::version);
+  for (auto &F : M) {
+    if (F.empty()) {
+      continue;
+    }
+    auto encode = [&F, &bbInvocations](raw_ostream &out) {
+      encodeULEB128(F.size(), out);
+      for (auto &bb : F) {
+        auto it = bbInvocations.find(&bb);
+        encodeULEB128((it != bbInvocations.end()) ? it->second : 0, out);
+      }
+    };
+    writer.addSection(F.getName(),
+                      HotProfileCache::computeFunctionHash(F),
+                      encode);
+  }
+
+  /*
+   * Write the file.
+   */
+  return writer.write(fileName, {}, "HotProfileCache");
+}
+
+uint64_t HotProfileCache::computeFunctionHash(Function &F) {
+  std::vector<uint64_t> words;
+
+  /*
+   * Hash the code.
+   */
+  words.push_back(IRHash::computeFunctionHash(F));
+
+  /*
+   * Hash the profile metadata: the entry count and the branch weights.
+   */
+  auto entryCount = F.getEntryCount();
+  words.push_back(entryCount.hasValue());
+  if (entryCount.hasValue()) {
+    words.push_back(entryCount->getCount());
+  }
+  for (auto &bb : F) {
+    auto terminator = bb.getTerminator();
+    if (terminator == nullptr) {
+      continue;
+    }
+    auto profile = terminator->getMetadata(LLVMContext::MD_prof);
+    if (profile == nullptr) {
+      continue;
+    }
+    for (auto &operand : profile->operands()) {
+      if (auto s = dyn_cast<MDString>(operand)) {
+        words.push_back(IRHash::hashString(s->getString()));
+      } else if (auto c = mdconst::dyn_extract<ConstantInt>(operand)) {
+        words.push_back(c->getZExtValue());
+      }
+    }
+  }
+
+  return IRHash::hashWords(words);
+}
+
+} // namespace arcana::noelle
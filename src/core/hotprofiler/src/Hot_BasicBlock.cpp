@@ -24,7 +24,8 @@
 
 namespace arcana::noelle {
 
-void Hot::setBasicBlockInvocations(BasicBlock *bb, uint64_t invocations) {
+void Hot::setBasicBlockInvocations(BasicBlock *bb,
+                                   uint64_t invocations) const {
 
   /*
    * Check if bb is the entry point of a function.
@@ -58,6 +59,7 @@ bool Hot::hasBeenExecuted(BasicBlock *bb) const {
 uint64_t Hot::getInvocations(BasicBlock *bb) const {
   assert(bb != nullptr);
 
+  this->loadProfile(*bb->getParent());
   auto inv = this->bbInvocations.at(bb);
 
   return inv;
@@ -103,11 +105,16 @@ uint64_t Hot::getStaticInstructions(
 
 double Hot::getBranchFrequency(BasicBlock *sourceBB,
                                BasicBlock *targetBB) const {
-  auto &branchSuccessors = this->branchProbability.at(sourceBB);
+  this->loadBranchProfile(*sourceBB->getParent());
 
   /*
    * Check if we have information about the branch.
    */
+  auto branchSuccessorsIt = this->branchProbability.find(sourceBB);
+  if (branchSuccessorsIt == this->branchProbability.end()) {
+    return 0;
+  }
+  auto &branchSuccessors = branchSuccessorsIt->second;
   if (branchSuccessors.find(targetBB) == branchSuccessors.end()) {
 
     /*
@@ -128,7 +135,7 @@ double Hot::getBranchFrequency(BasicBlock *sourceBB,
 
 void Hot::setBranchFrequency(BasicBlock *src,
                              BasicBlock *dst,
-                             double branchFrequency) {
+                             double branchFrequency) const {
   auto &branchSuccessors = this->branchProbability[src];
   branchSuccessors[dst] = branchFrequency;
 
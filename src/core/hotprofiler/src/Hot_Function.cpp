@@ -46,19 +46,21 @@ uint64_t Hot::getStaticInstructions(
 }
 
 uint64_t Hot::getSelfInstructions(Function *f) const {
+  this->loadProfile(*f);
   auto insts = this->functionSelfInstructions.at(f);
 
   return insts;
 }
 
 uint64_t Hot::getInvocations(Function *f) const {
+  this->loadProfile(*f);
   auto invs = this->functionInvocations.at(f);
 
   return invs;
 }
 
 void Hot::setFunctionTotalInstructions(Function *f,
-                                       uint64_t totalInstructions) {
+                                       uint64_t totalInstructions) const {
   this->functionTotalInstructions[f] = totalInstructions;
 
   return;
@@ -73,9 +75,16 @@ bool Hot::isFunctionTotalInstructionsAvailable(Function &F) const {
 }
 
 uint64_t Hot::getTotalInstructions(Function *f) const {
-  if (!this->isFunctionTotalInstructionsAvailable(*f)) {
+  if (f->empty()) {
     return 0;
   }
+
+  /*
+   * Compute the total instructions of @f if we haven't done it already.
+   */
+  if (!this->isFunctionTotalInstructionsAvailable(*f)) {
+    this->computeTotalInstructionsOfCallees(*f);
+  }
   auto t = this->functionTotalInstructions.at(f);
 
   return t;
@@ -78,6 +78,19 @@ uint64_t Hot::getInvocations(Instruction *i) const {
 }
 
 uint64_t Hot::getTotalInstructions(Instruction *i) const {
+
+  /*
+   * The total instructions of a function are distributed among the call
+   * instructions that use it.
+   */
+  if (auto callInst = dyn_cast<CallBase>(i)) {
+    for (auto &operand : callInst->operands()) {
+      if (auto f = dyn_cast<Function>(operand.get())) {
+        this->distributeTotalInstructionsAmongCallers(*f);
+      }
+    }
+  }
+
   if (this->instructionTotalInstructions.find(i)
       == this->instructionTotalInstructions.end()) {
 
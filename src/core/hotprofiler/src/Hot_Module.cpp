@@ -25,12 +25,26 @@
 namespace arcana::noelle {
 
 uint64_t Hot::getSelfInstructions(void) const {
+  this->computeModuleCounters();
+
   return this->moduleNumberOfInstructionsExecuted;
 }
 
 bool Hot::hasBeenExecuted(void) const {
-  if (this->getSelfInstructions() > 0) {
-    return true;
+
+  /*
+   * Basic blocks have profile counts only if their function has an entry
+   * count, and the entry block is executed as many times as the function.
+   * So checking the entry counts avoids loading the profiles.
+   */
+  for (auto &F : this->M) {
+    if (F.empty()) {
+      continue;
+    }
+    auto entryCount = F.getEntryCount();
+    if (entryCount.hasValue() && (entryCount->getCount() > 0)) {
+      return true;
+    }
   }
 
   return false;
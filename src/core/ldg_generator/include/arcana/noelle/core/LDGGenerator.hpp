@@ -24,7 +24,7 @@
 
 #include "arcana/noelle/core/SystemHeaders.hpp"
 #include "arcana/noelle/core/CompilationOptionsManager.hpp"
-#include "arcana/noelle/core/DependenceAnalysis.hpp"
+#include "arcana/noelle/core/DependenceAnalysisDispatcher.hpp"
 #include "arcana/noelle/core/PDG.hpp"
 #include "arcana/noelle/core/LoopStructure.hpp"
 #include "arcana/noelle/core/InductionVariables.hpp"
@@ -38,6 +38,8 @@ public:
 
   void addAnalysis(DependenceAnalysis *a);
 
+  const DependenceAnalysisDispatcher &getDependenceAnalyses(void) const;
+
   bool areLoopDependenceAnalysesEnabled(void) const;
 
   void enableLoopDependenceAnalyses(bool enabled);
@@ -54,7 +56,7 @@ public:
   static std::set<AliasAnalysisEngine *> getLoopAliasAnalysisEngines(void);
 
 private:
-  std::set<DependenceAnalysis *> ddAnalyses;
+  DependenceAnalysisDispatcher ddAnalyses;
   bool loopDependenceAnalysesEnabled;
 
   void removeDependences(PDG *loopDG, LoopStructure *loop);
@@ -22,72 +22,18 @@
 #include "arcana/noelle/core/LDGGenerator.hpp"
 #include "arcana/noelle/core/LoopIterationSpaceAnalysis.hpp"
 #include "arcana/noelle/core/LoopCarriedDependencies.hpp"
-#include "arcana/noelle/core/DataFlow.hpp"
+#include "arcana/noelle/core/CFGReachability.hpp"
 #include "LoopAwareMemDepAnalysis.hpp"
 
 namespace arcana::noelle {
 
-// TODO: Refactor along with HELIX's exact same implementation of this method
-DataFlowResult *computeReachabilityFromInstructions(
-    LoopStructure *loopStructure) {
-  assert(loopStructure != nullptr);
-
-  auto loopHeader = loopStructure->getHeader();
-  auto loopFunction = loopStructure->getFunction();
+void LDGGenerator::improveDependenceGraph(PDG *loopDG, LoopStructure *loop) {
 
   /*
-   * Run the data flow analysis needed to identify the locations where signal
-   * instructions will be placed.
+   * Drop the cached verdicts of the dependence analyses if the function of
+   * the loop changed since they were computed.
    */
-  auto dfa = DataFlowEngine{};
-  auto computeGEN = [](Instruction *i, DataFlowResult *df) {
-    assert(i != nullptr);
-    assert(df != nullptr);
-    auto &gen = df->GEN(i);
-    gen.insert(i);
-    return;
-  };
-  auto computeOUT = [loopHeader](Instruction *inst,
-                                 Instruction *succ,
-                                 std::set<Value *> &OUT,
-                                 DataFlowResult *df) {
-    assert(succ != nullptr);
-    assert(df != nullptr);
-
-    /*
-     * Check if the successor is the header.
-     * In this case, we do not propagate the reachable instructions.
-     * We do this because we are interested in understanding the reachability of
-     * instructions within a single iteration.
-     */
-    auto succBB = succ->getParent();
-    if (succBB == loopHeader) {
-      return;
-    }
-
-    /*
-     * Propagate the data flow values.
-     */
-    auto &inS = df->IN(succ);
-    OUT.insert(inS.begin(), inS.end());
-    return;
-  };
-  auto computeIN =
-      [](Instruction *inst, std::set<Value *> &IN, DataFlowResult *df) {
-        assert(inst != nullptr);
-        assert(df != nullptr);
-
-        auto &genI = df->GEN(inst);
-        auto &outI = df->OUT(inst);
-        IN.insert(outI.begin(), outI.end());
-        IN.insert(genI.begin(), genI.end());
-        return;
-      };
-
-  return dfa.applyBackward(loopFunction, computeGEN, computeIN, computeOUT);
-}
-
-void LDGGenerator::improveDependenceGraph(PDG *loopDG, LoopStructure *loop) {
+  this->ddAnalyses.refreshCache(*loop->getFunction());
 
   /*
    * Remove dependences.
@@ -156,25 +102,19 @@ void LDGGenerator::removeDependences(PDG *loopDG, LoopStructure *loop) {
     /*
      * Try to remove the current memory dependence.
      */
-    for (auto dda : this->ddAnalyses) {
-      if (!dda->canThereBeAMemoryDataDependence(srcInst, dstInst, *loop)) {
-        toDelete.insert(memDep);
-        break;
-      }
-      auto r = dda->isThereThisMemoryDataDependenceType(
-          memDep->getDataDependenceType(),
-          srcInst,
-          dstInst,
-          *loop);
-      switch (r) {
-
-        case MemoryDataDependenceStrength::CANNOT_EXIST:
-          toDelete.insert(memDep);
-          break;
-
-        default:
-          break;
-      }
+    if (!this->ddAnalyses.canThereBeAMemoryDataDependence(srcInst,
+                                                          dstInst,
+                                                          *loop)) {
+      toDelete.insert(memDep);
+      continue;
+    }
+    auto r = this->ddAnalyses.isThereThisMemoryDataDependenceType(
+        memDep->getDataDependenceType(),
+        srcInst,
+        dstInst,
+        *loop);
+    if (r == MemoryDataDependenceStrength::CANNOT_EXIST) {
+      toDelete.insert(memDep);
     }
   }
 
@@ -193,7 +133,12 @@ LDGGenerator::LDGGenerator() {
 }
 
 void LDGGenerator::addAnalysis(DependenceAnalysis *a) {
-  this->ddAnalyses.insert(a);
+  this->ddAnalyses.addAnalysis(a);
+}
+
+const DependenceAnalysisDispatcher &LDGGenerator::getDependenceAnalyses(
+    void) const {
+  return this->ddAnalyses;
 }
 
 PDG *LDGGenerator::generateLoopDependenceGraph(PDG *functionDG,
@@ -353,9 +298,12 @@ void LDGGenerator::runAffineAnalysis(PDG &loopDG,
       LoopIterationSpaceAnalysis(&loopNode, ivManager, scalarEvolution);
 
   /*
-   * Compute the reachability of instructions within the loop.
+   * Prepare the reachability of instructions within an iteration of the loop.
+   * Reachable basic blocks are computed only for the sources of the
+   * dependences checked below.
    */
-  auto dfr = computeReachabilityFromInstructions(loopStructure);
+  CFGReachability reachability(*loopStructure->getFunction(),
+                               loopStructure->getHeader());
 
   std::unordered_set<DGEdge<Value, Value> *> edgesToRemove;
   for (auto dependency :
@@ -381,8 +329,7 @@ void LDGGenerator::runAffineAnalysis(PDG &loopDG,
      * remove dependencies between a producer and consumer where we know the
      * producer can NEVER reach the consumer during the same iteration
      */
-    auto &afterInstructions = dfr->OUT(fromInst);
-    if (afterInstructions.find(toInst) != afterInstructions.end()) {
+    if (reachability.canReach(fromInst, toInst)) {
       continue;
     }
 
@@ -399,11 +346,6 @@ void LDGGenerator::runAffineAnalysis(PDG &loopDG,
     loopDG.removeEdge(edge);
   }
 
-  /*
-   * Free the memory
-   */
-  delete dfr;
-
   return;
 }
 
@@ -455,11 +397,8 @@ void LDGGenerator::removeLoopCarriedDependences(PDG *loopDG,
     /*
      * Try to disprove the loop-carried property of the dependence.
      */
-    for (auto dda : this->ddAnalyses) {
-      if (!dda->canThisDependenceBeLoopCarried(dep, *loop)) {
-        dep->setLoopCarried(false);
-        break;
-      }
+    if (!this->ddAnalyses.canThisDependenceBeLoopCarried(dep, *loop)) {
+      dep->setLoopCarried(false);
     }
   }
 
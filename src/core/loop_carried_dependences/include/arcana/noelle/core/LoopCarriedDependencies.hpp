@@ -28,6 +28,7 @@
 #include "arcana/noelle/core/SCCDAG.hpp"
 #include "arcana/noelle/core/SCC.hpp"
 #include "arcana/noelle/core/LoopForest.hpp"
+#include "arcana/noelle/core/CFGReachability.hpp"
 
 namespace arcana::noelle {
 
@@ -47,13 +48,21 @@ public:
       SCCDAG &sccdag);
 
 private:
+  /*
+   * Reachability within an iteration of a loop, indexed by that loop.
+   */
+  using Reachabilities = std::unordered_map<LoopStructure *, CFGReachability>;
+
   static bool isALoopCarriedDependence(LoopTree *loopNode,
                                        const DominatorSummary &DS,
+                                       Reachabilities &reachabilities,
                                        DGEdge<Value, Value> *edge);
 
-  static bool canBasicBlockReachHeaderBeforeOther(const LoopStructure &LS,
-                                                  BasicBlock *I,
-                                                  BasicBlock *J);
+  static bool canBasicBlockReachHeaderBeforeOther(
+      const LoopStructure &LS,
+      CFGReachability &reachability,
+      BasicBlock *I,
+      BasicBlock *J);
 };
 
 } // namespace arcana::noelle
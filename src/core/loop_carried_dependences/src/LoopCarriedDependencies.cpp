@@ -31,9 +31,13 @@ void LoopCarriedDependencies::setLoopCarriedDependencies(
     assert(!edge->isLoopCarriedDependence() && "Flag was already set");
   }
 
+  Reachabilities reachabilities;
   for (auto edge : dgForLoops.getEdges()) {
-    auto loop =
-        LoopCarriedDependencies::isALoopCarriedDependence(loopNode, DS, edge);
+    auto loop = LoopCarriedDependencies::isALoopCarriedDependence(
+        loopNode,
+        DS,
+        reachabilities,
+        edge);
     if (!loop) {
       continue;
     }
@@ -46,6 +50,7 @@ void LoopCarriedDependencies::setLoopCarriedDependencies(
 bool LoopCarriedDependencies::isALoopCarriedDependence(
     LoopTree *loopNode,
     const DominatorSummary &DS,
+    Reachabilities &reachabilities,
     DGEdge<Value, Value> *edge) {
 
   /*
@@ -180,8 +185,15 @@ bool LoopCarriedDependencies::isALoopCarriedDependence(
        */
       auto producerB = producerI->getParent();
       auto consumerB = consumerI->getParent();
+      auto &reachability =
+          reachabilities
+              .try_emplace(consumerLoop,
+                           *consumerLoop->getFunction(),
+                           consumerLoop->getHeader())
+              .first->second;
       auto mustProducerReachConsumerBeforeHeader =
           !canBasicBlockReachHeaderBeforeOther(*consumerLoop,
+                                               reachability,
                                                producerB,
                                                consumerB);
       if (mustProducerReachConsumerBeforeHeader) {
@@ -273,6 +285,7 @@ std::set<DGEdge<Value, Value> *> LoopCarriedDependencies::
 
 bool LoopCarriedDependencies::canBasicBlockReachHeaderBeforeOther(
     const LoopStructure &LS,
+    CFGReachability &reachability,
     BasicBlock *I,
     BasicBlock *J) {
 
@@ -287,8 +300,31 @@ bool LoopCarriedDependencies::canBasicBlockReachHeaderBeforeOther(
   if (I == J) {
     return true;
   }
-
   auto header = LS.getHeader();
+  if (I == header) {
+    return true;
+  }
+
+  /*
+   * If @J cannot be reached from @I within the current iteration, then @I
+   * reaches the header without going through @J if and only if it reaches a
+   * latch.
+   * Paths that leave the loop cannot come back to a latch without going
+   * through the header.
+   */
+  if (!reachability.canReach(I, J)) {
+    for (auto latch : LS.getLatches()) {
+      if ((latch == I) || reachability.canReach(I, latch)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /*
+   * @J can be reached from @I: check whether all paths from @I to the header
+   * go through @J.
+   */
   auto exitsVector = LS.getLoopExitBasicBlocks();
   std::set<BasicBlock *> exits(exitsVector.begin(), exitsVector.end());
   std::queue<BasicBlock *> queue;
@@ -131,6 +131,8 @@ LoopCarriedVariable::LoopCarriedVariable(const LoopStructure &loop,
     for (auto edge : node->getOutgoingEdges()) {
       if (!isa<ControlDependence<Value, Value>>(edge))
         continue;
+      if (!sccOfVariableOnly->isIncluded(edge))
+        continue;
 
       /*
        * This value produces a control dependency
@@ -320,7 +322,7 @@ std::unordered_set<Value *> LoopCarriedVariable::getConsumersOfVariable(
     auto node = externalNodePair.second;
     for (auto edge : node->getIncomingEdges()) {
       auto producer = edge->getSrc();
-      if (sccOfVariableOnly->isExternal(producer))
+      if (!sccOfVariableOnly->isInternal(producer))
         continue;
 
       /*
@@ -22,6 +22,8 @@
 #ifndef NOELLE_SRC_CORE_LOOP_CONTENT_LOOPDEPENDENCEINFO_H_
 #define NOELLE_SRC_CORE_LOOP_CONTENT_LOOPDEPENDENCEINFO_H_
 
+#include <chrono>
+
 #include "arcana/noelle/core/SystemHeaders.hpp"
 #include "arcana/noelle/core/CompilationOptionsManager.hpp"
 #include "arcana/noelle/core/PDG.hpp"
@@ -141,8 +143,35 @@ public:
 
   InductionVariableManager *getInductionVariableManager(void) const;
 
+  /*
+   * Return the SCCDAG attributes of the loop.
+   *
+   * The SCCDAG of the loop and its attributes are computed the first time this
+   * method is invoked. They are computed from the loop dependence graph as it
+   * is at that time, and the attributes also inspect the IR of the function of
+   * the loop as it is at that time.
+   *
+   * The loop dependence graph is not updated when the IR changes. Hence, the
+   * IR of the loop must not be modified between the creation of the loop
+   * content and the first invocation of this method: otherwise, the SCCDAG
+   * would be computed from dependences of the old code and attributes of the
+   * new one. Clients that modify the loop before inspecting its SCCs (e.g.,
+   * hoisting invariants first) must invoke this method before modifying the
+   * loop; the result then describes the loop as it was when the loop content
+   * was created.
+   */
   SCCDAGAttrs *getSCCManager(void) const;
 
+  /*
+   * Compute the SCCDAG of the loop (but not its attributes) if it has not been
+   * computed yet.
+   *
+   * This method only reads the dependence graph of the loop and it does not
+   * touch the LLVM IR. Hence, it can run concurrently with the same method
+   * invoked on loop contents of other loops.
+   */
+  void computeSCCDAG(void) const;
+
   InvariantManager *getInvariantManager(void) const;
 
   LoopTransformationsManager *getLoopTransformationsManager(void) const;
@@ -157,6 +186,13 @@ public:
 
   uint64_t getCompileTimeTripCount(void) const;
 
+  /*
+   * Return the time (in microseconds) spent computing each sub-analysis of the
+   * loop that has been computed so far.
+   * Sub-analyses are listed in the order they have been computed.
+   */
+  std::vector<std::pair<std::string, uint64_t>> getAnalysisTimes(void) const;
+
   /*
    * Deconstructor.
    */
@@ -187,7 +223,14 @@ private:
 
   uint64_t tripCount;
 
-  SCCDAGAttrs *sccdagAttrs;
+  /*
+   * The SCCDAG and its attributes are computed on demand by getSCCManager.
+   */
+  mutable SCCDAG *loopSCCDAG;
+
+  mutable SCCDAGAttrs *sccdagAttrs;
+
+  mutable std::vector<std::pair<std::string, uint64_t>> analysisTimes;
 
   LoopTransformationsManager *loopTransformationsManager;
 
@@ -198,13 +241,21 @@ private:
    */
   void fetchLoopAndBBInfo(Loop *l, ScalarEvolution &SE);
 
-  std::pair<PDG *, SCCDAG *> createDGsForLoop(LDGGenerator &ldgGenerator,
-                                              CompilationOptionsManager *com,
-                                              Loop *l,
-                                              LoopTree *loopNode,
-                                              PDG *functionDG,
-                                              DominatorSummary &DS,
-                                              ScalarEvolution &SE);
+  PDG *createDGForLoop(LDGGenerator &ldgGenerator,
+                       CompilationOptionsManager *com,
+                       Loop *l,
+                       LoopTree *loopNode,
+                       PDG *functionDG,
+                       DominatorSummary &DS,
+                       ScalarEvolution &SE);
+
+  SCCDAG *createSCCDAGForLoop(void) const;
+
+  void computeSCCDAGAttributes(void) const;
+
+  void recordAnalysisTime(
+      std::string const &analysisName,
+      std::chrono::steady_clock::time_point const &startTime) const;
 
   uint64_t computeTripCounts(Loop *l, ScalarEvolution &SE);
 
@@ -156,6 +156,8 @@ LoopContent::LoopContent(
     uint32_t chunkSize)
   : loop{ loopNode },
     memoryCloningAnalysis{ nullptr },
+    loopSCCDAG{ nullptr },
+    sccdagAttrs{ nullptr },
     com{ compilationOptionsManager } {
   assert(this->loop != nullptr);
 
@@ -182,20 +184,23 @@ LoopContent::LoopContent(
 
   /*
    * Fetch the loop dependence graph (i.e., the subset of the PDG that relates
-   * to the loop @l) and its SCCDAG.
+   * to the loop @l).
+   *
+   * The SCCDAG of the loop is not computed here: it is computed the first time
+   * it is needed (see getSCCManager).
    */
+  auto startTime = std::chrono::steady_clock::now();
   this->fetchLoopAndBBInfo(l, SE);
   auto ls = this->getLoopStructure();
   auto loopExitBlocks = ls->getLoopExitBasicBlocks();
-  auto DGs = this->createDGsForLoop(ldgGenerator,
-                                    compilationOptionsManager,
-                                    l,
-                                    loopNode,
-                                    fG,
-                                    DS,
-                                    SE);
-  this->loopDG = DGs.first;
-  auto loopSCCDAG = DGs.second;
+  this->loopDG = this->createDGForLoop(ldgGenerator,
+                                       compilationOptionsManager,
+                                       l,
+                                       loopNode,
+                                       fG,
+                                       DS,
+                                       SE);
+  this->recordAnalysisTime("Loop dependence graph", startTime);
 
   /*
    * Create the environment for the loop.
@@ -203,6 +208,7 @@ LoopContent::LoopContent(
    * Exclude stack objects that will be cloned. To do so, we need to collect
    * this set of objects.
    */
+  startTime = std::chrono::steady_clock::now();
   std::set<Value *> stackObjectsThatWillBeCloned;
   if (this->memoryCloningAnalysis != nullptr) {
     for (auto memObject :
@@ -227,14 +233,17 @@ LoopContent::LoopContent(
   }
   this->environment =
       new LoopEnvironment(loopDG, loopExitBlocks, stackObjectsThatWillBeCloned);
+  this->recordAnalysisTime("Environment", startTime);
 
   /*
    * Create the invariant manager.
    *
    * This step identifies instructions that are loop invariants.
    */
+  startTime = std::chrono::steady_clock::now();
   auto topLoop = this->loop->getLoop();
   this->invariantManager = new InvariantManager(topLoop, this->loopDG);
+  this->recordAnalysisTime("Invariants", startTime);
 
   /*
    * Create the induction variable manager.
@@ -245,7 +254,13 @@ LoopContent::LoopContent(
    * Memory dependences don't matter for the IV detection.
    * Then, we compute the SCCDAG of this sub-LDG.
    * And then, we can identify IVs from this new SCCDAG.
+   *
+   * The induction variables and the iteration space analysis rely on the
+   * scalar evolution of the function and on the LLVM loop, which are only
+   * valid while the caller holds them. Hence, they cannot be computed on
+   * demand.
    */
+  startTime = std::chrono::steady_clock::now();
   auto loopSCCDAGWithoutMemoryDeps =
       ldgGenerator.computeSCCDAGWithOnlyVariableAndControlDependences(loopDG);
   this->inductionVariables =
@@ -257,26 +272,94 @@ LoopContent::LoopContent(
                                    *l);
 
   /*
-   * Calculate various attributes on SCCs
+   * Collect induction variable information
+   */
+  this->inductionVariables->getLoopGoverningInductionVariable(*topLoop);
+  this->recordAnalysisTime("Induction variables", startTime);
+
+  /*
+   * Compute the iteration space of the loop.
    */
-  this->sccdagAttrs = new SCCDAGAttrs(
-      compilationOptionsManager->canFloatsBeConsideredRealNumbers(),
-      loopDG,
-      loopSCCDAG,
-      this->loop,
-      *inductionVariables,
-      DS);
+  startTime = std::chrono::steady_clock::now();
   this->domainSpaceAnalysis =
       new LoopIterationSpaceAnalysis(this->loop, *this->inductionVariables, SE);
+  this->recordAnalysisTime("Iteration space", startTime);
+
+  return;
+}
+
+void LoopContent::computeSCCDAG(void) const {
 
   /*
-   * Collect induction variable information
+   * Check if the SCCDAG has already been computed.
    */
-  this->inductionVariables->getLoopGoverningInductionVariable(*topLoop);
+  if (this->loopSCCDAG != nullptr) {
+    return;
+  }
+
+  /*
+   * Compute the SCCDAG of the loop.
+   */
+  auto startTime = std::chrono::steady_clock::now();
+  this->loopSCCDAG = this->createSCCDAGForLoop();
+  this->recordAnalysisTime("SCCDAG", startTime);
+
+  return;
+}
+
+void LoopContent::computeSCCDAGAttributes(void) const {
+
+  /*
+   * Compute the SCCDAG of the loop.
+   */
+  this->computeSCCDAG();
+
+  /*
+   * Compute the dominators of the function that contains the loop.
+   *
+   * The dominator summary given to the constructor is owned by the caller and
+   * it is typically freed right after the loop content has been created.
+   * Hence, we compute our own.
+   */
+  auto startTime = std::chrono::steady_clock::now();
+  auto F = this->getLoopStructure()->getFunction();
+  DominatorTree DT(*F);
+  PostDominatorTree PDT(*F);
+  DominatorSummary DS(DT, PDT);
+
+  /*
+   * Calculate various attributes on SCCs
+   */
+  this->sccdagAttrs =
+      new SCCDAGAttrs(this->com->canFloatsBeConsideredRealNumbers(),
+                      this->loopDG,
+                      this->loopSCCDAG,
+                      this->loop,
+                      *this->inductionVariables,
+                      DS);
+  this->recordAnalysisTime("SCCDAG attributes", startTime);
+
+  return;
+}
+
+void LoopContent::recordAnalysisTime(
+    std::string const &analysisName,
+    std::chrono::steady_clock::time_point const &startTime) const {
+  auto endTime = std::chrono::steady_clock::now();
+  auto elapsed =
+      std::chrono::duration_cast<std::chrono::microseconds>(endTime - startTime)
+          .count();
+  this->analysisTimes.push_back(
+      std::make_pair(analysisName, static_cast<uint64_t>(elapsed)));
 
   return;
 }
 
+std::vector<std::pair<std::string, uint64_t>> LoopContent::getAnalysisTimes(
+    void) const {
+  return this->analysisTimes;
+}
+
 void LoopContent::copyParallelizationOptionsFrom(LoopContent *otherLC) {
   auto otherLTM = otherLC->getLoopTransformationsManager();
   assert(otherLTM != nullptr);
@@ -322,14 +405,13 @@ uint64_t LoopContent::computeTripCounts(Loop *l, ScalarEvolution &SE) {
   return tripCount;
 }
 
-std::pair<PDG *, SCCDAG *> LoopContent::createDGsForLoop(
-    LDGGenerator &ldgGenerator,
-    CompilationOptionsManager *com,
-    Loop *l,
-    LoopTree *loopNode,
-    PDG *functionDG,
-    DominatorSummary &DS,
-    ScalarEvolution &SE) {
+PDG *LoopContent::createDGForLoop(LDGGenerator &ldgGenerator,
+                                  CompilationOptionsManager *com,
+                                  Loop *l,
+                                  LoopTree *loopNode,
+                                  PDG *functionDG,
+                                  DominatorSummary &DS,
+                                  ScalarEvolution &SE) {
 
   /*
    * Perform loop-aware memory dependence analysis to refine the loop dependence
@@ -362,10 +444,15 @@ std::pair<PDG *, SCCDAG *> LoopContent::createDGsForLoop(
                                                                       DS);
   }
 
+  return loopDG;
+}
+
+SCCDAG *LoopContent::createSCCDAGForLoop(void) const {
+
   /*
    * Build a SCCDAG of loop-internal instructions
    */
-  auto loopInternalDG = loopDG->clone(false);
+  auto loopInternalDG = this->loopDG->clone(false);
   auto loopSCCDAG = new SCCDAG(loopInternalDG);
 
   /*
@@ -379,7 +466,7 @@ std::pair<PDG *, SCCDAG *> LoopContent::createDGsForLoop(
    */
   {
     int64_t numberOfInstructionsInLoop = 0;
-    for (auto bbIter : l->blocks()) {
+    for (auto bbIter : this->getLoopStructure()->getBasicBlocks()) {
       for (auto &I : *bbIter) {
         assert(std::find(loopInternals.begin(), loopInternals.end(), &I)
                != loopInternals.end());
@@ -397,7 +484,7 @@ std::pair<PDG *, SCCDAG *> LoopContent::createDGsForLoop(
   }
 #endif
 
-  return std::make_pair(loopDG, loopSCCDAG);
+  return loopSCCDAG;
 }
 
 void LoopContent::removeUnnecessaryDependenciesWithThreadSafeLibraryFunctions(
@@ -629,6 +716,9 @@ LoopTree *LoopContent::getLoopHierarchyStructures(void) const {
 }
 
 SCCDAGAttrs *LoopContent::getSCCManager(void) const {
+  if (this->sccdagAttrs == nullptr) {
+    this->computeSCCDAGAttributes();
+  }
   return this->sccdagAttrs;
 }
 
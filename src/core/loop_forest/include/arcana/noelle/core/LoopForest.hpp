@@ -106,15 +106,33 @@ public:
 
   LoopTree *getInnermostLoopThatContains(BasicBlock *bb) const;
 
+  LoopTree *getOutermostLoopThatContains(Instruction *i) const;
+
+  LoopTree *getOutermostLoopThatContains(BasicBlock *bb) const;
+
   ~LoopForest();
 
 private:
+  friend class LoopTree;
   std::unordered_map<LoopStructure *, LoopTree *> nodes;
   std::unordered_set<LoopTree *> trees;
   std::unordered_map<Function *, std::unordered_set<LoopStructure *>>
       functionLoops;
   std::unordered_map<BasicBlock *, LoopTree *> headerLoops;
 
+  /*
+   * Innermost loop of the forest that contains a basic block.
+   * It is kept up to date as trees are added and removed, and as nodes are
+   * deleted.
+   */
+  std::unordered_map<BasicBlock *, LoopTree *> innermostLoops;
+
+  void addToInnermostLoops(LoopTree *tree);
+
+  void removeFromInnermostLoops(LoopTree *tree);
+
+  void removeNode(LoopTree *node);
+
   void addChildrenToTree(
       LoopTree *root,
       std::unordered_map<Function *, DominatorSummary *> const &doms,
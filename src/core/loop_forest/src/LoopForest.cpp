@@ -69,6 +69,13 @@ LoopForest::LoopForest(
     this->trees.insert(n);
   }
 
+  /*
+   * Index the basic blocks of the trees.
+   */
+  for (auto t : this->trees) {
+    this->addToInnermostLoops(t);
+  }
+
   return;
 }
 
@@ -226,6 +233,7 @@ void LoopForest::removeTree(LoopTree *tree) {
   assert(this->trees.find(tree) != this->trees.end());
   this->trees.erase(tree);
   assert(this->trees.find(tree) == this->trees.end());
+  this->removeFromInnermostLoops(tree);
 
   return;
 }
@@ -234,12 +242,80 @@ void LoopForest::addTree(LoopTree *tree) {
   assert(this->trees.find(tree) == this->trees.end());
 
   this->trees.insert(tree);
+  this->addToInnermostLoops(tree);
+
+  return;
+}
+
+void LoopForest::addToInnermostLoops(LoopTree *tree) {
+
+  /*
+   * Sub-loops are visited after their parent, so they override it.
+   */
+  auto f = [this](LoopTree *n, uint32_t treeLevel) -> bool {
+    for (auto bb : n->getLoop()->getBasicBlocks()) {
+      this->innermostLoops[bb] = n;
+    }
+    return false;
+  };
+  tree->visitPreOrder(f);
+
+  return;
+}
+
+void LoopForest::removeFromInnermostLoops(LoopTree *tree) {
+
+  /*
+   * Trees do not share basic blocks, so all basic blocks of @tree are
+   * contained by its loops only.
+   */
+  for (auto bb : tree->getLoop()->getBasicBlocks()) {
+    this->innermostLoops.erase(bb);
+  }
+
+  return;
+}
+
+void LoopForest::removeNode(LoopTree *node) {
+
+  /*
+   * Forget the node.
+   */
+  auto loop = node->getLoop();
+  auto nodeIt = this->nodes.find(loop);
+  if ((nodeIt != this->nodes.end()) && (nodeIt->second == node)) {
+    this->nodes.erase(nodeIt);
+  }
+  auto headerIt = this->headerLoops.find(loop->getHeader());
+  if ((headerIt != this->headerLoops.end()) && (headerIt->second == node)) {
+    this->headerLoops.erase(headerIt);
+  }
+
+  /*
+   * The basic blocks whose innermost loop is @node now belong to its parent.
+   */
+  for (auto bb : loop->getBasicBlocks()) {
+    auto it = this->innermostLoops.find(bb);
+    if ((it == this->innermostLoops.end()) || (it->second != node)) {
+      continue;
+    }
+    if (node->parent != nullptr) {
+      it->second = node->parent;
+    } else {
+      this->innermostLoops.erase(it);
+    }
+  }
 
   return;
 }
 
 LoopForest::~LoopForest() {
-  for (auto pair : this->nodes) {
+
+  /*
+   * Deleting a node unregisters it from @this.
+   */
+  auto nodesToDelete = this->nodes;
+  for (auto pair : nodesToDelete) {
     delete pair.second;
   }
 }
@@ -262,69 +338,38 @@ LoopTree *LoopForest::getNode(LoopStructure *loop) const {
 }
 
 LoopTree *LoopForest::getInnermostLoopThatContains(Instruction *i) const {
-  LoopTree *n = nullptr;
-
-  /*
-   * Identify only the trees that are about the same function of the target
-   * instruction.
-   */
-  for (auto tree : this->getTrees()) {
+  auto n = this->getInnermostLoopThatContains(i->getParent());
+  return n;
+}
 
-    /*
-     * Fetch the function of the tree
-     */
-    auto ls = tree->getLoop();
-    auto treeFunction = ls->getFunction();
+LoopTree *LoopForest::getInnermostLoopThatContains(BasicBlock *bb) const {
+  auto it = this->innermostLoops.find(bb);
+  if (it == this->innermostLoops.end()) {
+    return nullptr;
+  }
 
-    /*
-     * Skip trees about functions that do not include the target instruction.
-     */
-    if (treeFunction != i->getFunction()) {
-      continue;
-    }
+  return it->second;
+}
 
-    /*
-     * The current tree is of the same function of the target instruction.
-     *
-     * Check if the current tree includes the target instruction.
-     */
-    if (!ls->isIncluded(i)) {
+LoopTree *LoopForest::getOutermostLoopThatContains(Instruction *i) const {
+  auto n = this->getOutermostLoopThatContains(i->getParent());
+  return n;
+}
 
-      /*
-       * The current tree doesn't include the target instruction.
-       */
-      continue;
-    }
+LoopTree *LoopForest::getOutermostLoopThatContains(BasicBlock *bb) const {
 
-    /*
-     * The current tree includes the target instruction.
-     *
-     * Fetch the innermost loop that contains it.
-     */
-    LoopTree *innermostLoop = nullptr;
-    auto finderFunction = [i, &innermostLoop](LoopTree *n,
-                                              uint32_t treeLevel) -> bool {
-      /*
-       * Fetch the loop
-       */
-      auto loop = n->getLoop();
-      if (loop->isIncluded(i)) {
-        innermostLoop = n;
-        return true;
-      }
-      return false;
-    };
-    tree->visitPostOrder(finderFunction);
-    assert(innermostLoop != nullptr);
-    return innermostLoop;
+  /*
+   * The outermost loop is the root of the tree of the innermost one.
+   */
+  auto n = this->getInnermostLoopThatContains(bb);
+  if (n == nullptr) {
+    return nullptr;
+  }
+  while (n->getParent() != nullptr) {
+    n = n->getParent();
   }
 
   return n;
 }
 
-LoopTree *LoopForest::getInnermostLoopThatContains(BasicBlock *bb) const {
-  auto n = this->getInnermostLoopThatContains(&*bb->begin());
-  return n;
-}
-
 } // namespace arcana::noelle
@@ -110,6 +110,17 @@ LoopStructure *LoopTree::getInnermostLoopThatContains(BasicBlock *bb) {
 
   /*
    * The basic block @bb is included.
+   * The innermost loop of the forest that contains it is within @this.
+   */
+  auto innermostNode = this->forest->getInnermostLoopThatContains(bb);
+  for (auto n = innermostNode; n != nullptr; n = n->parent) {
+    if (n == this) {
+      return innermostNode->getLoop();
+    }
+  }
+
+  /*
+   * @this is not part of the forest anymore.
    * We now need to find the innermost loop that contains it.
    */
   LoopStructure *innerLoop = nullptr;
@@ -155,31 +166,9 @@ LoopStructure *LoopTree::getOutermostLoopThatContains(BasicBlock *bb) {
 
   /*
    * The basic block @bb is included.
-   * We now need to find the outermost loop that contains it.
+   * Hence, the outermost loop that contains it is the current one.
    */
-  LoopStructure *outerLoop = nullptr;
-  uint32_t outerLoopLevel = 0;
-  auto f = [bb, &outerLoop, &outerLoopLevel](LoopTree *n,
-                                             uint32_t treeLevel) -> bool {
-    auto nl = n->getLoop();
-    if (!nl->isIncluded(bb)) {
-      return false;
-    }
-    if (outerLoop == nullptr) {
-      outerLoop = nl;
-      outerLoopLevel = treeLevel;
-      return false;
-    }
-    assert(treeLevel != outerLoopLevel);
-    if (treeLevel < outerLoopLevel) {
-      outerLoop = nl;
-      outerLoopLevel = treeLevel;
-    }
-    return false;
-  };
-  this->visitPreOrder(f);
-
-  return outerLoop;
+  return this->loop;
 }
 
 LoopTree *LoopTree::getParent(void) const {
@@ -287,6 +276,11 @@ bool LoopTree::visitPostOrder(
 
 LoopTree::~LoopTree() {
 
+  /*
+   * Unregister @this from the forest.
+   */
+  this->forest->removeNode(this);
+
   /*
    * Check if this object is an internal node of a tree.
    */
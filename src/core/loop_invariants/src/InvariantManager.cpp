@@ -31,7 +31,7 @@ InvariantManager::InvariantManager(LoopStructure *loop, PDG *loopDG)
   /*
    * Check every instruction of the loop.
    */
-  for (auto inst : loop->getInstructions()) {
+  for (auto inst : loop->instructions()) {
 
     /*
      * Check if it is loop invariant according to the loop structure.
@@ -112,7 +112,7 @@ InvariantManager::InvarianceChecker::InvarianceChecker(
   /*
    * Check all instructions.
    */
-  for (auto inst : loop->getInstructions()) {
+  for (auto inst : loop->instructions()) {
 
     /*
      * Since we will rely on data dependencies to identify loop invariants, we
@@ -28,6 +28,76 @@ namespace arcana::noelle {
 
 class LoopStructure {
 public:
+  /*
+   * Iterator over the instructions of a loop.
+   * Instructions are visited basic block by basic block, following the order
+   * of the basic blocks of the loop.
+   */
+  class instruction_iterator {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Instruction *;
+    using difference_type = std::ptrdiff_t;
+    using pointer = Instruction **;
+    using reference = Instruction *;
+
+    instruction_iterator(std::vector<BasicBlock *>::const_iterator bbIt,
+                         std::vector<BasicBlock *>::const_iterator bbEnd)
+      : bbIt{ bbIt },
+        bbEnd{ bbEnd } {
+      this->skipEmptyBasicBlocks();
+      return;
+    }
+
+    Instruction *operator*(void) const {
+      return &*this->instIt;
+    }
+
+    instruction_iterator &operator++(void) {
+      this->instIt++;
+      if (this->instIt == (*this->bbIt)->end()) {
+        this->bbIt++;
+        this->skipEmptyBasicBlocks();
+      }
+      return *this;
+    }
+
+    instruction_iterator operator++(int) {
+      auto old = *this;
+      ++(*this);
+      return old;
+    }
+
+    bool operator==(const instruction_iterator &other) const {
+      if (this->bbIt != other.bbIt) {
+        return false;
+      }
+      if (this->bbIt == this->bbEnd) {
+        return true;
+      }
+      return this->instIt == other.instIt;
+    }
+
+    bool operator!=(const instruction_iterator &other) const {
+      return !(*this == other);
+    }
+
+  private:
+    std::vector<BasicBlock *>::const_iterator bbIt;
+    std::vector<BasicBlock *>::const_iterator bbEnd;
+    BasicBlock::iterator instIt;
+
+    void skipEmptyBasicBlocks(void) {
+      while ((this->bbIt != this->bbEnd) && (*this->bbIt)->empty()) {
+        this->bbIt++;
+      }
+      if (this->bbIt != this->bbEnd) {
+        this->instIt = (*this->bbIt)->begin();
+      }
+      return;
+    }
+  };
+
   LoopStructure(Loop *l);
 
   std::optional<uint64_t> getID(void);
@@ -57,12 +127,27 @@ public:
    */
   uint32_t getNestingLevel(void) const;
 
-  std::unordered_set<BasicBlock *> getLatches(void) const;
+  const std::unordered_set<BasicBlock *> &getLatches(void) const;
 
-  std::unordered_set<BasicBlock *> getBasicBlocks(void) const;
+  const std::unordered_set<BasicBlock *> &getBasicBlocks(void) const;
 
+  /*
+   * Return a new set with all instructions of the loop.
+   * Use instructions() to iterate over them without building the set.
+   */
   std::unordered_set<Instruction *> getInstructions(void) const;
 
+  /*
+   * Iterate over the basic blocks (instructions) of the loop without copying
+   * them.
+   * The order is the one of the LLVM loop the current one has been built
+   * from, which is deterministic across runs.
+   */
+  iterator_range<std::vector<BasicBlock *>::const_iterator> blocks(
+      void) const;
+
+  iterator_range<instruction_iterator> instructions(void) const;
+
   uint64_t getNumberOfInstructions(void) const;
 
   std::vector<BasicBlock *> getLoopExitBasicBlocks(void) const;
@@ -89,6 +174,7 @@ private:
   std::unordered_set<Instruction *> invariants;
   std::unordered_set<BasicBlock *> latchBBs;
   std::unordered_set<BasicBlock *> bbs;
+  std::vector<BasicBlock *> orderedBBs;
 
   /*
    * Certain parallelization schemes rely on indexing exit blocks, so some
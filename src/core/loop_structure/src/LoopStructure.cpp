@@ -49,6 +49,7 @@ LoopStructure::LoopStructure(Loop *l) {
   for (auto bb : l->blocks()) {
     // NOTE: Unsure if this is program forward order
     this->bbs.insert(bb);
+    this->orderedBBs.push_back(bb);
     if (l->isLoopLatch(bb)) {
       latchBBs.insert(bb);
     }
@@ -119,20 +120,33 @@ uint32_t LoopStructure::getNestingLevel(void) const {
   return this->depth;
 }
 
-std::unordered_set<BasicBlock *> LoopStructure::getLatches(void) const {
+const std::unordered_set<BasicBlock *> &LoopStructure::getLatches(
+    void) const {
   return this->latchBBs;
 }
 
-std::unordered_set<BasicBlock *> LoopStructure::getBasicBlocks(void) const {
+const std::unordered_set<BasicBlock *> &LoopStructure::getBasicBlocks(
+    void) const {
   return this->bbs;
 }
 
+iterator_range<std::vector<BasicBlock *>::const_iterator> LoopStructure::
+    blocks(void) const {
+  return make_range(this->orderedBBs.cbegin(), this->orderedBBs.cend());
+}
+
+iterator_range<LoopStructure::instruction_iterator> LoopStructure::
+    instructions(void) const {
+  instruction_iterator b(this->orderedBBs.cbegin(), this->orderedBBs.cend());
+  instruction_iterator e(this->orderedBBs.cend(), this->orderedBBs.cend());
+  return make_range(b, e);
+}
+
 std::unordered_set<Instruction *> LoopStructure::getInstructions(void) const {
   std::unordered_set<Instruction *> insts{};
-  for (auto bb : this->bbs) {
-    for (auto &inst : *bb) {
-      insts.insert(&inst);
-    }
+  insts.reserve(this->getNumberOfInstructions());
+  for (auto inst : this->instructions()) {
+    insts.insert(inst);
   }
 
   return insts;
@@ -19,13 +19,104 @@
  OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
  OR OTHER DEALINGS IN THE SOFTWARE.
  */
+#include <atomic>
+#include <thread>
 #include "arcana/noelle/core/MayPointsToAnalysis.hpp"
+#include "arcana/noelle/core/SCCCAG.hpp"
 #include "MpaUtils.hpp"
 
 namespace arcana::noelle {
 
 MayPointsToAnalysis::MayPointsToAnalysis() {}
 
+MayPointsToAnalysis::MayPointsToAnalysis(noelle::CallGraph *cg,
+                                         uint32_t numberOfThreads) {
+  assert(cg != nullptr);
+
+  /*
+   * A function can be summarized once all the nodes of the SCCDAG of the call
+   * graph it may invoke have been handled.
+   * Nodes that are cycles of the call graph are handled without summarizing
+   * their functions.
+   */
+  SCCCAG sccCAG(cg);
+  std::unordered_map<SCCCAGNode *, uint64_t> pendingCallees;
+  std::vector<SCCCAGNode *> readyNodes;
+  for (auto node : sccCAG.getNodes()) {
+    auto numberOfCallees = sccCAG.getOutgoingEdges(node).size();
+    pendingCallees[node] = numberOfCallees;
+    if (numberOfCallees == 0) {
+      readyNodes.push_back(node);
+    }
+  }
+
+  while (!readyNodes.empty()) {
+
+    /*
+     * Collect the functions that are ready to be summarized.
+     */
+    std::vector<Function *> functions;
+    for (auto node : readyNodes) {
+      if (node->isAnSCC()) {
+        continue;
+      }
+      auto f =
+          static_cast<SCCCAGNode_Function *>(node)->getNode()->getFunction();
+      if (f->empty()) {
+        continue;
+      }
+      functions.push_back(f);
+    }
+
+    /*
+     * Summarize them.
+     * Each thread only reads the summaries of the previous iterations.
+     */
+    std::vector<BitVector> summaries(functions.size());
+    std::atomic<uint64_t> nextFunction{ 0 };
+    auto worker = [this, &functions, &summaries, &nextFunction](void) {
+      while (true) {
+        auto functionIndex = nextFunction.fetch_add(1);
+        if (functionIndex >= functions.size()) {
+          return;
+        }
+        MpaSummary funcSum(functions[functionIndex], &escapingArguments);
+        funcSum.doMayPointsToAnalysisForArguments();
+        summaries[functionIndex] = funcSum.getEscapingArguments();
+      }
+    };
+    auto numberOfWorkers =
+        std::min<uint64_t>(numberOfThreads, functions.size());
+    if (numberOfWorkers <= 1) {
+      worker();
+    } else {
+      std::vector<std::thread> threads;
+      for (auto i = 0u; i < numberOfWorkers; i++) {
+        threads.push_back(std::thread(worker));
+      }
+      for (auto &t : threads) {
+        t.join();
+      }
+    }
+    for (auto i = 0u; i < functions.size(); i++) {
+      escapingArguments[functions[i]] = std::move(summaries[i]);
+    }
+
+    /*
+     * Find the nodes that are now ready.
+     */
+    std::vector<SCCCAGNode *> nextReadyNodes;
+    for (auto node : readyNodes) {
+      for (auto &[caller, edge] : sccCAG.getIncomingEdges(node)) {
+        if (--pendingCallees[caller] == 0) {
+          nextReadyNodes.push_back(caller);
+        }
+      }
+    }
+    readyNodes = std::move(nextReadyNodes);
+  }
+}
+
 bool MayPointsToAnalysis::mayAlias(Value *ptr1, Value *ptr2) {
   assert(ptr1->getType()->isPointerTy() && ptr2->getType()->isPointerTy());
 
@@ -78,7 +169,19 @@ bool MayPointsToAnalysis::mayAlias(Value *ptr1, Value *ptr2) {
     }
     return false;
   } else {
-    return true;
+    /*
+     * The pointers belong to different functions: they may alias only if
+     * both of them may point to memory objects that other functions can
+     * access.
+     */
+    auto funcSum1 = getFunctionSummary(func1);
+    funcSum1->doMayPointsToAnalysis();
+    if (!funcSum1->mayBeAccessedByOtherFunctions(stripped1)) {
+      return false;
+    }
+    auto funcSum2 = getFunctionSummary(func2);
+    funcSum2->doMayPointsToAnalysis();
+    return funcSum2->mayBeAccessedByOtherFunctions(stripped2);
   }
 }
 
@@ -93,13 +196,9 @@ bool MayPointsToAnalysis::mayEscape(Instruction *inst) {
 
 bool MayPointsToAnalysis::notPrivatizable(GlobalVariable *globalVar,
                                           Function *currentF) {
-  auto funcSum = getFunctionSummary(currentF);
-  funcSum->doMayPointsToAnalysisFor(globalVar);
-
-  auto result = funcSum->mayBePointedByUnknown(globalVar)
-                || funcSum->mayBePointedByReturnValue(globalVar);
-  funcSum->clearPointsToSummary();
-  return result;
+  auto funcSum = getPrivatizationSummary(currentF);
+  funcSum->doMayPointsToAnalysisForGlobals();
+  return funcSum->mayBePointedByOthers(globalVar);
 }
 
 std::unordered_set<Value *> MayPointsToAnalysis::getPointees(
@@ -111,18 +210,42 @@ std::unordered_set<Value *> MayPointsToAnalysis::getPointees(
   return funcSum->getPointeeMemobjs(ptr);
 }
 
+void MayPointsToAnalysis::invalidate(Function *currentF) {
+  for (auto summaries : { &functionSummaries, &privatizationSummaries }) {
+    auto it = summaries->find(currentF);
+    if (it == summaries->end()) {
+      continue;
+    }
+    delete it->second;
+    summaries->erase(it);
+  }
+}
+
 MayPointsToAnalysis::~MayPointsToAnalysis() {
   for (auto &[f, funcSum] : functionSummaries) {
     delete funcSum;
   }
   functionSummaries.clear();
+  for (auto &[f, funcSum] : privatizationSummaries) {
+    delete funcSum;
+  }
+  privatizationSummaries.clear();
 }
 
 MpaSummary *MayPointsToAnalysis::getFunctionSummary(Function *currentF) {
   if (functionSummaries.find(currentF) == functionSummaries.end()) {
-    functionSummaries[currentF] = new MpaSummary(currentF);
+    functionSummaries[currentF] =
+        new MpaSummary(currentF, &escapingArguments);
   }
   return functionSummaries[currentF];
 }
 
+MpaSummary *MayPointsToAnalysis::getPrivatizationSummary(Function *currentF) {
+  if (privatizationSummaries.find(currentF) == privatizationSummaries.end()) {
+    privatizationSummaries[currentF] =
+        new MpaSummary(currentF, &escapingArguments);
+  }
+  return privatizationSummaries[currentF];
+}
+
 } // namespace arcana::noelle
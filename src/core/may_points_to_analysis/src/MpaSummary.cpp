@@ -26,7 +26,11 @@ using namespace std;
 
 namespace arcana::noelle {
 
-MpaSummary::MpaSummary(Function *currentF) : currentF(currentF) {
+MpaSummary::MpaSummary(
+    Function *currentF,
+    const unordered_map<Function *, BitVector> *escapingArguments)
+  : currentF(currentF),
+    escapingArguments(escapingArguments) {
 
   auto insertPointer = [&](Value *v) {
     if (v->getType()->isPointerTy()) {
@@ -92,6 +96,7 @@ MpaSummary::MpaSummary(Function *currentF) : currentF(currentF) {
             break;
           case FREE:
             freeInsts.insert(callInst);
+            insertPointer(callInst->getArgOperand(0));
             break;
           case REALLOC:
             insertPointer(callInst);
@@ -173,6 +178,138 @@ bool MpaSummary::mayBePointedByReturnValue(Value *memobj) {
   return false;
 }
 
+bool MpaSummary::mayBePointedByOthers(GlobalVariable *globalVar) {
+  assert(mpaFinished);
+
+  /*
+   * Global variables that are not used as pointers in the current function
+   * have no memory object: nothing in the function can point to them.
+   */
+  if (privatizeCandidates.find(globalVar) == privatizeCandidates.end()) {
+    return false;
+  }
+  auto memobjId = memobj2nodeId.at(globalVar);
+
+  if (getReachableMemobjs(UnknownMemobjId).test(memobjId)) {
+    return true;
+  }
+  for (auto retPtr : returnPointers) {
+    auto retPtrId = getPtrId(retPtr);
+    if (getReachableMemobjs(retPtrId).test(memobjId)) {
+      return true;
+    }
+  }
+
+  /*
+   * The other privatizeCandidates would be represented by the "unknown" memory
+   * object when asking about @globalVar alone.
+   */
+  for (auto otherGlobalVar : privatizeCandidates) {
+    if (otherGlobalVar == globalVar) {
+      continue;
+    }
+    auto otherMemobjId = memobj2nodeId.at(otherGlobalVar);
+    if (getReachableMemobjs(otherMemobjId).test(memobjId)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool MpaSummary::mayBeAccessedByOtherFunctions(Value *ptr) {
+  assert(mpaFinished);
+
+  auto stripped = strip(ptr);
+  if (ptr2nodeId.find(stripped) == ptr2nodeId.end()) {
+    return true;
+  }
+  auto ptrId = ptr2nodeId[stripped];
+
+  /*
+   * Only memory objects allocated by the current function can be hidden from
+   * the others, and only if they are not reachable from the "unknown" memory
+   * object, from the return value, or from the arguments of callInsts.
+   */
+  auto pointees = getPointeeBitVector(ptrId);
+  if (pointees.test(UnknownMemobjId)) {
+    return true;
+  }
+  auto mayReach = [&](NodeID nodeId) {
+    return getReachableMemobjs(nodeId).anyCommon(pointees);
+  };
+  if (mayReach(UnknownMemobjId)) {
+    return true;
+  }
+  for (auto retPtr : returnPointers) {
+    if (mayReach(getPtrId(retPtr))) {
+      return true;
+    }
+  }
+  for (auto argId : passedToCallees) {
+    if (mayReach(argId)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+BitVector MpaSummary::getEscapingArguments(void) {
+  assert(mpaFinished);
+  BitVector escaping(currentF->arg_size(), false);
+
+  /*
+   * Collect the memory objects that may be modified to point to other memory
+   * objects, or that may be freed.
+   * A pointer converted to an integer can be stored anywhere, so its memory
+   * objects are conservatively considered modified too.
+   */
+  auto modified = getEmptyBitVector();
+  auto addPointees = [&](Value *ptr) {
+    if (ptr->getType()->isPointerTy()) {
+      modified |= getPointeeBitVector(getPtrId(ptr));
+    }
+  };
+  for (auto &inst : instructions(currentF)) {
+    if (auto storeInst = dyn_cast<StoreInst>(&inst)) {
+      if (storeInst->getValueOperand()->getType()->isPointerTy()) {
+        addPointees(storeInst->getPointerOperand());
+      }
+    } else if (auto ptrToInt = dyn_cast<PtrToIntInst>(&inst)) {
+      addPointees(ptrToInt->getPointerOperand());
+    } else if (auto callInst = dyn_cast<CallBase>(&inst)) {
+      switch (getCalleeFunctionType(callInst)) {
+        case FREE:
+        case REALLOC:
+        case MEM_COPY:
+          addPointees(callInst->getArgOperand(0));
+          break;
+        default:
+          break;
+      }
+    }
+  }
+
+  for (auto arg : argumentCandidates) {
+    auto memobjId = memobj2nodeId.at(arg);
+    auto escapes = modified.test(memobjId)
+                   || getReachableMemobjs(UnknownMemobjId).test(memobjId);
+    for (auto retPtr : returnPointers) {
+      escapes |= getReachableMemobjs(getPtrId(retPtr)).test(memobjId);
+    }
+    for (auto otherArg : argumentCandidates) {
+      if (otherArg == arg) {
+        continue;
+      }
+      auto otherMemobjId = memobj2nodeId.at(otherArg);
+      escapes |= getReachableMemobjs(otherMemobjId).test(memobjId);
+    }
+    if (escapes) {
+      escaping.set(arg->getArgNo());
+    }
+  }
+  return escaping;
+}
+
 BitVector MpaSummary::getPointeeBitVector(NodeID nodeId) {
   if (pointsTo.find(nodeId) != pointsTo.end()) {
     return pointsTo[nodeId];
@@ -201,9 +338,38 @@ unordered_set<NodeID> MpaSummary::getreachableMemobjIds(NodeID ptrId) {
   return reachable;
 }
 
+const BitVector &MpaSummary::getReachableMemobjs(NodeID nodeId) {
+  assert(mpaFinished);
+  auto it = reachableMemobjs.find(nodeId);
+  if (it != reachableMemobjs.end()) {
+    return it->second;
+  }
+
+  auto reachable = getEmptyBitVector();
+  queue<NodeID> todolist;
+  todolist.push(nodeId);
+  while (!todolist.empty()) {
+    auto currentId = todolist.front();
+    todolist.pop();
+
+    auto pointsToIt = pointsTo.find(currentId);
+    if (pointsToIt == pointsTo.end()) {
+      continue;
+    }
+    for (auto memobjId : pointsToIt->second.set_bits()) {
+      if (!reachable.test(memobjId)) {
+        reachable.set(memobjId);
+        todolist.push(memobjId);
+      }
+    }
+  }
+
+  return reachableMemobjs[nodeId] = std::move(reachable);
+}
+
 BitVector MpaSummary::getEmptyBitVector(void) {
-  auto bitVecSize = 1 + getAllocations().size();
-  return BitVector(bitVecSize, false);
+  assert(numberOfMemobjs > 0);
+  return BitVector(numberOfMemobjs, false);
 }
 
 BitVector MpaSummary::onlyPointsTo(NodeID memobjId) {
@@ -224,8 +390,11 @@ unordered_set<Value *> MpaSummary::getAllocations(void) {
   for (auto &callocInst : callocInsts) {
     allocations.insert(callocInst);
   }
-  if (privatizeCandidate) {
-    allocations.insert(privatizeCandidate);
+  for (auto globalVar : privatizeCandidates) {
+    allocations.insert(globalVar);
+  }
+  for (auto arg : argumentCandidates) {
+    allocations.insert(arg);
   }
   return allocations;
 }
@@ -244,6 +413,37 @@ bool MpaSummary::addCopyEdge(NodeID src, NodeID dst) {
   return copyOutEdges[src].insert(dst).second;
 }
 
+bool MpaSummary::mayEscapeThroughCall(CallBase *callInst, Value *ptr) {
+  if (escapingArguments == nullptr) {
+    return true;
+  }
+  auto calleeFunc = callInst->getCalledFunction();
+  if (calleeFunc == nullptr) {
+    return true;
+  }
+  auto summaryIt = escapingArguments->find(calleeFunc);
+  if (summaryIt == escapingArguments->end()) {
+    return true;
+  }
+  auto &escaping = summaryIt->second;
+
+  /*
+   * @ptr may also be the called operand or an operand bundle, which are not
+   * covered by the escape summary.
+   */
+  auto isArgument = false;
+  for (auto argID = 0u; argID < callInst->arg_size(); argID++) {
+    if (callInst->getArgOperand(argID) != ptr) {
+      continue;
+    }
+    isArgument = true;
+    if ((argID >= escaping.size()) || escaping.test(argID)) {
+      return true;
+    }
+  }
+  return !isArgument;
+}
+
 void MpaSummary::doMayPointsToAnalysis(void) {
   if (!mpaFinished) {
     initPtInfo();
@@ -252,15 +452,43 @@ void MpaSummary::doMayPointsToAnalysis(void) {
   }
 }
 
-void MpaSummary::doMayPointsToAnalysisFor(GlobalVariable *globalVar) {
-  clearPointsToSummary();
-  privatizeCandidate = globalVar;
+void MpaSummary::doMayPointsToAnalysisForGlobals(void) {
+  if (mpaFinished) {
+    return;
+  }
+
+  /*
+   * Every non-constant global variable used as a pointer in the current
+   * function is a privatizeCandidate.
+   */
+  for (auto ptr : pointers) {
+    auto globalVar = dyn_cast<GlobalVariable>(ptr);
+    if (globalVar && !globalVar->isConstant()) {
+      privatizeCandidates.insert(globalVar);
+    }
+  }
+  doMayPointsToAnalysis();
+}
+
+void MpaSummary::doMayPointsToAnalysisForArguments(void) {
+  if (mpaFinished) {
+    return;
+  }
+
+  for (auto &arg : currentF->args()) {
+    if (arg.getType()->isPointerTy()) {
+      argumentCandidates.insert(&arg);
+    }
+  }
   doMayPointsToAnalysis();
 }
 
 void MpaSummary::clearPointsToSummary(void) {
-  privatizeCandidate = nullptr;
+  privatizeCandidates.clear();
+  argumentCandidates.clear();
   mpaFinished = false;
+  numberOfMemobjs = 0;
+  reachableMemobjs.clear();
   nextNodeId = 1;
   ptr2nodeId.clear();
   memobj2nodeId.clear();
@@ -270,6 +498,7 @@ void MpaSummary::clearPointsToSummary(void) {
   incomingStores.clear();
   outgoingLoads.clear();
   usedAsFuncArg.clear();
+  passedToCallees.clear();
 }
 
 void MpaSummary::initPtInfo(void) {
@@ -282,9 +511,11 @@ void MpaSummary::initPtInfo(void) {
    * MayPointsToAnalysis.hpp).
    * 2. For each memory object allocated by alloca/malloc/calloc, assign a
    * unique NodeID.
-   * 3. If a global variable is privatizeCandidate, its memory objecg will also
-   * be assigned a unique NodeID.
+   * 3. If a global variable is a privatizeCandidate, its memory object will
+   * also be assigned a unique NodeID.
+   * 4. The same holds for an argument that is an argumentCandidate.
    */
+  numberOfMemobjs = 1 + allocations.size();
   nodeId2memobj[UnknownMemobjId] = nullptr;
   memobj2nodeId[nullptr] = UnknownMemobjId;
 
@@ -309,16 +540,20 @@ void MpaSummary::initPtInfo(void) {
    *     in the current function.
    * (4) Similarly, global variables and the callInsts will also point to the
    *     "unknown" memory object.
-   * (5) PrivatizeCandidate will points to its own memory object instead of the
+   * (5) PrivatizeCandidates will point to their own memory object instead of
+   *     the "unknown" memory object, which conservatively points to the
    *     "unknown" memory object (see MayPointsToAnalysis.hpp).
+   * (6) ArgumentCandidates will point to their own memory object, which
+   *     points to itself (see MayPointsToAnalysis.hpp).
    *
    * 3. Add copy edges for pointers and memory objects.
    * (1) Copy edges between pointers can be added through PHINode, SelectInst,
    *     MemcpyInst and realloc().
    * (2) Add copy edges from arguments of callInsts to the "unknown" memory
    * object because the "unknown" memory object may point to escaped memory
-   * objects. (3) Add copy edges from the "unknown" memory object to the
-   * callInst if the callInst returns a pointer.
+   * objects, unless the escape summary of the callee says they don't escape.
+   * (3) Add copy edges from the "unknown" memory object to the callInst if the
+   * callInst returns a pointer.
    *
    * 4. Record uses of pointers.
    * If a pointer is used as the pointer operand of a store/load instruction,
@@ -326,6 +561,13 @@ void MpaSummary::initPtInfo(void) {
    * can help the may points-to analysis add more copy edges.
    */
   pointsTo[UnknownMemobjId] = onlyPointsTo(UnknownMemobjId);
+  for (auto globalVar : privatizeCandidates) {
+    pointsTo[memobj2nodeId[globalVar]] = onlyPointsTo(UnknownMemobjId);
+  }
+  for (auto arg : argumentCandidates) {
+    auto memobjId = memobj2nodeId[arg];
+    pointsTo[memobjId] = onlyPointsTo(memobjId);
+  }
 
   for (auto &ptr : pointers) {
     auto ptrId = getPtrId(ptr);
@@ -390,8 +632,11 @@ void MpaSummary::initPtInfo(void) {
             break;
           case USER_DEFINED:
           case UNKNOWN:
-            usedAsFuncArg.insert(ptrId);
-            addCopyEdge(ptrId, UnknownMemobjId);
+            passedToCallees.insert(ptrId);
+            if (mayEscapeThroughCall(callInst, ptr)) {
+              usedAsFuncArg.insert(ptrId);
+              addCopyEdge(ptrId, UnknownMemobjId);
+            }
             break;
           default:
             break;
@@ -537,14 +782,17 @@ void MpaSummary::handleCopyEdges(NodeID srcId) {
 }
 
 bool MpaSummary::unionPts(NodeID srcId, NodeID dstId) {
-  BitVector oldPts = pointsTo[dstId];
-  BitVector newPts = unite(oldPts, pointsTo[srcId]);
-  if (oldPts == newPts) {
+  /*
+   * Update pts(dstId) in place, and only if pts(srcId) has a memobj that
+   * pts(dstId) does not.
+   */
+  auto &srcPts = pointsTo[srcId];
+  auto &dstPts = pointsTo[dstId];
+  if (!srcPts.test(dstPts)) {
     return false;
-  } else {
-    pointsTo[dstId] = newPts;
-    return true;
   }
+  dstPts |= srcPts;
+  return true;
 }
 
 } // namespace arcana::noelle
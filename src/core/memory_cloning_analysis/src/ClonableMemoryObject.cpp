@@ -269,7 +269,7 @@ void ClonableMemoryObject::setObjectScope(AllocaInst *allocation,
   /*
    * Look for lifetime calls in the loop.
    */
-  for (auto inst : loop->getInstructions()) {
+  for (auto inst : loop->instructions()) {
 
     /*
      * Check if the current instruction is a call to lifetime intrinsics.
@@ -79,7 +79,11 @@ public:
          bool disableSVF,
          bool disableSVFCallGraph,
          bool disableAllocAA,
-         bool disableRA);
+         bool disableRA,
+         uint32_t pdgThreads,
+         std::string pdgSidecarFileName,
+         uint32_t sccdagThreads,
+         std::string profileCacheFileName);
 
   FunctionsManager *getFunctionsManager(void);
 
@@ -159,6 +163,15 @@ public:
   std::vector<LoopContent *> *getLoopContents(Function *function,
                                               double minimumHotness);
 
+  /*
+   * Compute the SCCDAGs of @loops ahead of their use, with the number of
+   * threads given by -noelle-sccdag-threads.
+   * The SCCDAG of a loop is otherwise computed the first time it is requested
+   * (see LoopContent::getSCCManager). So only pass the loops whose SCCDAGs
+   * will be used.
+   */
+  void computeSCCDAGs(std::vector<LoopContent *> const &loops);
+
   LoopContent *getLoopContent(LoopStructure *loop);
 
   LoopContent *getLoopContent(
@@ -241,6 +254,8 @@ public:
 
   PDGGenerator &getPDGGenerator(void);
 
+  LDGGenerator &getLDGGenerator(void);
+
   bool verifyCode(void) const;
 
   ~Noelle();
@@ -255,6 +270,8 @@ private:
   Module &program;
   Hot *profiles;
   PDG *programDependenceGraph;
+  std::unordered_map<Function *, PDG *> functionDependenceGraphs;
+  std::unordered_map<Function *, size_t> functionDependenceGraphFingerprints;
   std::unordered_set<Transformation> enabledTransformations;
   Verbosity verbose;
   PDGGenerator pdgGenerator;
@@ -281,9 +298,13 @@ private:
   std::function<llvm::BranchProbabilityInfo &(Function &F)> getBPI;
   std::set<AliasAnalysisEngine *> aaEngines;
   Logger log;
+  uint32_t sccdagThreads;
+  std::string profileCacheFileName;
 
   PDG *getFunctionDependenceGraph(Function *f);
 
+  static size_t computeFunctionFingerprint(Function &f);
+
   uint32_t fetchTheNextValue(std::stringstream &stream);
 
   bool checkToGetLoopFilteringInfo(void);
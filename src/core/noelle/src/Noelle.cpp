@@ -46,7 +46,11 @@ Noelle::Noelle(
     bool disableSVF,
     bool disableSVFCallGraph,
     bool disableAllocAA,
-    bool disableRA)
+    bool disableRA,
+    uint32_t pdgThreads,
+    std::string pdgSidecarFileName,
+    uint32_t sccdagThreads,
+    std::string profileCacheFileName)
   : minHot{ minHot },
     program{ m },
     profiles{ nullptr },
@@ -65,7 +69,9 @@ Noelle::Noelle(
                   disableSVFCallGraph,
                   disableAllocAA,
                   disableRA,
-                  pdgVerbose },
+                  pdgVerbose,
+                  pdgThreads,
+                  pdgSidecarFileName },
     ldgGenerator{ ldgGenerator },
     filterFileName{ nullptr },
     hasReadFilterFile{ false },
@@ -88,7 +94,9 @@ Noelle::Noelle(
     getBFI{ getBFI },
     getBPI{ getBPI },
     aaEngines{},
-    log{ NoelleLumberjack, "Noelle" } {
+    log{ NoelleLumberjack, "Noelle" },
+    sccdagThreads{ sccdagThreads },
+    profileCacheFileName{ profileCacheFileName } {
 
   this->filterFileName = getenv("INDEX_FILE");
 
@@ -152,7 +160,10 @@ double Noelle::getMinimumHotness(void) const {
 
 Hot *Noelle::getProfiles(void) {
   if (this->profiles == nullptr) {
-    this->profiles = new Hot(this->program, this->getBFI, this->getBPI);
+    this->profiles = new Hot(this->program,
+                             this->getBFI,
+                             this->getBPI,
+                             this->profileCacheFileName);
   }
 
   return this->profiles;
@@ -205,6 +216,13 @@ uint64_t Noelle::numberOfProgramInstructions(void) const {
 
 Noelle::~Noelle() {
 
+  /*
+   * Free the function dependence graphs.
+   */
+  for (auto pair : this->functionDependenceGraphs) {
+    delete pair.second;
+  }
+
   return;
 }
 
@@ -287,4 +305,8 @@ PDGGenerator &Noelle::getPDGGenerator(void) {
   return this->pdgGenerator;
 }
 
+LDGGenerator &Noelle::getLDGGenerator(void) {
+  return this->ldgGenerator;
+}
+
 } // namespace arcana::noelle
@@ -133,6 +133,45 @@ static cl::opt<bool> PDGRADisable(
     cl::Hidden,
     cl::desc("Disable the use of reaching analysis to compute the PDG"));
 
+static cl::opt<int> PDGThreads(
+    "noelle-pdg-threads",
+    cl::ZeroOrMore,
+    cl::Hidden,
+    cl::init(1),
+    cl::desc(
+        "Number of threads used to compute the PDG (0: one per logical core)"));
+
+static cl::opt<std::string> PDGSidecar(
+    "noelle-pdg-sidecar",
+    cl::ZeroOrMore,
+    cl::Hidden,
+    cl::init(""),
+    cl::desc("Binary file used to store and load the PDG"));
+
+static cl::opt<std::string> ProfileCache(
+    "noelle-profile-cache",
+    cl::ZeroOrMore,
+    cl::Hidden,
+    cl::init(""),
+    cl::desc("Binary file used to store and load the profiles"));
+
+static cl::opt<int> SCCDAGThreads(
+    "noelle-sccdag-threads",
+    cl::ZeroOrMore,
+    cl::Hidden,
+    cl::init(1),
+    cl::desc("Number of threads used by Noelle::computeSCCDAGs to compute "
+             "the SCCDAGs of the loops ahead of their use (0: one per logical "
+             "core)"));
+
+static cl::opt<std::string> SystemRoot(
+    "noelle-sysfs-root",
+    cl::ZeroOrMore,
+    cl::Hidden,
+    cl::init(""),
+    cl::desc("Directory used instead of /sys to read the topology of the "
+             "machine"));
+
 NoellePass::NoellePass() : ModulePass{ ID }, n{ nullptr } {
 
   return;
@@ -178,6 +217,9 @@ bool NoellePass::runOnModule(Module &M) {
    */
   verbose = static_cast<Verbosity>(Verbose.getValue());
   minHot = ((double)(MinimumHotness.getValue())) / 1000;
+  if (SystemRoot.getNumOccurrences() > 0) {
+    Architecture::setSystemRoot(SystemRoot.getValue());
+  }
   auto optMaxCores = MaximumCores.getValue();
   if (optMaxCores == 0) {
     optMaxCores = Architecture::getNumberOfPhysicalCores();
@@ -221,6 +263,14 @@ bool NoellePass::runOnModule(Module &M) {
   auto disableAllocAA =
       (PDGAllocAADisable.getNumOccurrences() > 0) ? true : false;
   auto disableRA = (PDGRADisable.getNumOccurrences() > 0) ? true : false;
+  auto pdgThreads = PDGThreads.getValue();
+  if (pdgThreads <= 0) {
+    pdgThreads = Architecture::getNumberOfLogicalCores();
+  }
+  auto sccdagThreads = SCCDAGThreads.getValue();
+  if (sccdagThreads <= 0) {
+    sccdagThreads = Architecture::getNumberOfLogicalCores();
+  }
 
   /*
    * Allocate the managers.
@@ -296,7 +346,11 @@ bool NoellePass::runOnModule(Module &M) {
                        disableSVF,
                        disableSVFCallGraph,
                        disableAllocAA,
-                       disableRA);
+                       disableRA,
+                       pdgThreads,
+                       PDGSidecar.getValue(),
+                       sccdagThreads,
+                       ProfileCache.getValue());
 
   return false;
 }
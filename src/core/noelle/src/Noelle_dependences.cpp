@@ -33,6 +33,32 @@ PDG *Noelle::getProgramDependenceGraph(void) {
 
 PDG *Noelle::getFunctionDependenceGraph(Function *f) {
 
+  /*
+   * Check if we have already computed the function dependence graph (FDG) and
+   * the IR of the function did not change since then.
+   *
+   * Notice that the FDG is only as fresh as the program dependence graph
+   * (PDG) it is extracted from, which is not recomputed when the IR changes.
+   * Hence, a stale FDG is extracted again only to match the values that the
+   * PDG still has for @f; dependences of the new code of @f are not
+   * computed.
+   */
+  auto fingerprint = Noelle::computeFunctionFingerprint(*f);
+  auto it = this->functionDependenceGraphs.find(f);
+  if (it != this->functionDependenceGraphs.end()) {
+    auto cachedFDG = it->second;
+    if (this->functionDependenceGraphFingerprints[f] == fingerprint) {
+      return cachedFDG;
+    }
+
+    /*
+     * The FDG is stale.
+     */
+    delete cachedFDG;
+    this->functionDependenceGraphs.erase(it);
+    this->functionDependenceGraphFingerprints.erase(f);
+  }
+
   /*
    * Get the PDG
    * The FDG is a subset of it.
@@ -43,10 +69,40 @@ PDG *Noelle::getFunctionDependenceGraph(Function *f) {
    * Create the function dependence graph (FDG).
    */
   auto fdg = pdg->createFunctionSubgraph(*f);
+  if (fdg != nullptr) {
+    this->functionDependenceGraphs[f] = fdg;
+    this->functionDependenceGraphFingerprints[f] = fingerprint;
+  }
 
   return fdg;
 }
 
+size_t Noelle::computeFunctionFingerprint(Function &f) {
+
+  /*
+   * The fingerprint covers the identity of the arguments and of the
+   * instructions of @f, the opcodes of the instructions, and their operands.
+   * So rewriting an operand (e.g., by RAUW), swapping the operands of an
+   * instruction, or replacing an instruction with a new one allocated at the
+   * same address but with a different opcode or operands changes it.
+   */
+  auto fingerprint = hash_combine(f.arg_size(), f.size());
+  for (auto &arg : f.args()) {
+    fingerprint = hash_combine(fingerprint, &arg);
+  }
+  for (auto &bb : f) {
+    fingerprint = hash_combine(fingerprint, &bb, bb.size());
+    for (auto &inst : bb) {
+      fingerprint = hash_combine(fingerprint, &inst, inst.getOpcode());
+      for (auto &op : inst.operands()) {
+        fingerprint = hash_combine(fingerprint, op.get());
+      }
+    }
+  }
+
+  return fingerprint;
+}
+
 std::vector<SCC *> Noelle::sortByHotness(const std::set<SCC *> &SCCs) {
   std::vector<SCC *> s;
 
@@ -20,6 +20,8 @@
  OR OTHER DEALINGS IN THE SOFTWARE.
  */
 #include <algorithm>
+#include <atomic>
+#include <thread>
 
 #include "arcana/noelle/core/SystemHeaders.hpp"
 #include "arcana/noelle/core/LoopStructure.hpp"
@@ -797,6 +799,49 @@ std::vector<LoopContent *> *Noelle::getLoopContents(double minimumHotness) {
   return allLoops;
 }
 
+void Noelle::computeSCCDAGs(std::vector<LoopContent *> const &loops) {
+
+  /*
+   * Check if we have been asked to use more than one thread.
+   *
+   * Only the SCCDAGs are computed here. The rest of a loop content relies on
+   * the LLVM analyses of its function, which the pass manager computes on the
+   * fly one function at a time, and on the LLVM context (e.g., to create
+   * constants), which is not thread safe. SCCDAGs only need the dependence
+   * graph of their loop.
+   */
+  auto numberOfThreads =
+      std::min<uint64_t>(this->sccdagThreads, loops.size());
+  if (numberOfThreads <= 1) {
+    return;
+  }
+  log.debug() << "Compute the SCCDAGs of " << loops.size() << " loops with "
+              << numberOfThreads << " threads\n";
+
+  /*
+   * Loops are handed out one at a time to the first idle thread.
+   */
+  std::atomic<uint64_t> nextLoop{ 0 };
+  auto worker = [&loops, &nextLoop](void) {
+    while (true) {
+      auto loopIndex = nextLoop.fetch_add(1);
+      if (loopIndex >= loops.size()) {
+        return;
+      }
+      loops[loopIndex]->computeSCCDAG();
+    }
+  };
+  std::vector<std::thread> threads;
+  for (auto i = 0u; i < numberOfThreads; i++) {
+    threads.push_back(std::thread(worker));
+  }
+  for (auto &t : threads) {
+    t.join();
+  }
+
+  return;
+}
+
 uint32_t Noelle::getNumberOfProgramLoops(void) {
   return this->getNumberOfProgramLoops(this->minHot);
 }
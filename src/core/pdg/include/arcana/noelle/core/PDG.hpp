@@ -149,6 +149,13 @@ protected:
       PDG *newPDG,
       bool linkToExternal,
       std::unordered_set<DGEdge<Value, Value> *> const &edgesToIgnore);
+
+  void copyEdgeInto(
+      PDG *newPDG,
+      DGEdge<Value, Value> *oldEdge,
+      bool fromInclusion,
+      bool toInclusion,
+      std::unordered_set<DGEdge<Value, Value> *> const &edgesToIgnore);
 };
 
 } // namespace arcana::noelle
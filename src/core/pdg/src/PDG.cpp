@@ -183,38 +183,74 @@ void PDG::copyEdgesInto(
     PDG *newPDG,
     bool linkToExternal,
     std::unordered_set<DGEdge<Value, Value> *> const &edgesToIgnore) {
-  for (auto *oldEdge : allEdges) {
-    if (edgesToIgnore.find(oldEdge) != edgesToIgnore.end()) {
+
+  /*
+   * Only edges that touch an internal node of the new PDG can be copied.
+   * Hence, we walk the edges of these nodes rather than all edges of "this".
+   * This makes the cost of creating a subgraph proportional to the size of the
+   * subgraph rather than to the size of "this".
+   *
+   * Every edge is considered exactly once: from its source node if the source
+   * is internal to the new PDG, from its destination node otherwise.
+   */
+  for (auto internalNodePair : newPDG->internalNodePairs()) {
+    auto value = internalNodePair.first;
+    if (!this->isInGraph(value)) {
       continue;
     }
+    auto oldNode = this->fetchNode(value);
 
-    auto fromT = oldEdge->getSrc();
-    auto toT = oldEdge->getDst();
+    /*
+     * Copy the outgoing edges.
+     */
+    for (auto oldEdge : oldNode->getOutgoingEdges()) {
+      auto toT = oldEdge->getDst();
+      auto toInclusion = newPDG->isInternal(toT);
+      if (!linkToExternal && !toInclusion) {
+        continue;
+      }
+      this->copyEdgeInto(newPDG, oldEdge, true, toInclusion, edgesToIgnore);
+    }
 
     /*
-     * Check whether edge belongs to nodes within function F
+     * Copy the incoming edges that come from nodes outside the new PDG.
      */
-    auto fromInclusion = newPDG->isInternal(fromT);
-    auto toInclusion = newPDG->isInternal(toT);
-    if (!fromInclusion && !toInclusion) {
+    if (!linkToExternal) {
       continue;
     }
-    if (!linkToExternal && (!fromInclusion || !toInclusion)) {
-      continue;
+    for (auto oldEdge : oldNode->getIncomingEdges()) {
+      auto fromT = oldEdge->getSrc();
+      if (newPDG->isInternal(fromT)) {
+        continue;
+      }
+      this->copyEdgeInto(newPDG, oldEdge, false, true, edgesToIgnore);
     }
+  }
 
-    /*
-     * Create appropriate external nodes and associate edge to them
-     */
-    newPDG->fetchOrAddNode(fromT, fromInclusion);
-    newPDG->fetchOrAddNode(toT, toInclusion);
+  return;
+}
 
-    /*
-     * Copy edge to match properties (mem/var, must/may, RAW/WAW/WAR/control)
-     */
-    newPDG->copyAddEdge(*oldEdge);
+void PDG::copyEdgeInto(
+    PDG *newPDG,
+    DGEdge<Value, Value> *oldEdge,
+    bool fromInclusion,
+    bool toInclusion,
+    std::unordered_set<DGEdge<Value, Value> *> const &edgesToIgnore) {
+  if (edgesToIgnore.find(oldEdge) != edgesToIgnore.end()) {
+    return;
   }
 
+  /*
+   * Create appropriate external nodes and associate edge to them
+   */
+  newPDG->fetchOrAddNode(oldEdge->getSrc(), fromInclusion);
+  newPDG->fetchOrAddNode(oldEdge->getDst(), toInclusion);
+
+  /*
+   * Copy edge to match properties (mem/var, must/may, RAW/WAW/WAR/control)
+   */
+  newPDG->copyAddEdge(*oldEdge);
+
   return;
 }
 
@@ -437,12 +473,11 @@ PDG *PDG::clone(bool includeExternalNodes) {
 }
 
 PDG::~PDG() {
-  for (auto *edge : allEdges)
-    if (edge)
-      delete edge;
-  for (auto *node : allNodes)
-    if (node)
-      delete node;
+
+  /*
+   * Nodes and edges are released by the arena of DG<Value>.
+   */
+  return;
 }
 
 } // namespace arcana::noelle
@@ -22,16 +22,19 @@
 #ifndef NOELLE_SRC_CORE_PDG_ANALYSIS_PDGGENERATOR_H_
 #define NOELLE_SRC_CORE_PDG_ANALYSIS_PDGGENERATOR_H_
 
+#include "llvm/ADT/SparseBitVector.h"
 #include "arcana/noelle/core/SystemHeaders.hpp"
 #include "arcana/noelle/core/TalkDown.hpp"
 #include "arcana/noelle/core/AllocAA.hpp"
 #include "arcana/noelle/core/PDG.hpp"
+#include "arcana/noelle/core/PDGSidecar.hpp"
 #include "arcana/noelle/core/PDGPrinter.hpp"
 #include "arcana/noelle/core/DataFlow.hpp"
+#include "arcana/noelle/core/CFGReachability.hpp"
 #include "arcana/noelle/core/CallGraph.hpp"
 #include "arcana/noelle/core/AliasAnalysisEngine.hpp"
 #include "arcana/noelle/core/MayPointsToAnalysis.hpp"
-#include "arcana/noelle/core/DependenceAnalysis.hpp"
+#include "arcana/noelle/core/DependenceAnalysisDispatcher.hpp"
 #include "arcana/noelle/core/CallGraphAnalysis.hpp"
 
 namespace arcana::noelle {
@@ -52,18 +55,38 @@ public:
                bool disableSVFCallGraph,
                bool disableAllocAA,
                bool disableRA,
-               PDGVerbosity verbose);
+               PDGVerbosity verbose,
+               uint32_t numberOfThreads,
+               std::string sidecarFileName);
 
   void addAnalysis(DependenceAnalysis *a);
 
   void addAnalysis(CallGraphAnalysis *a);
 
+  const DependenceAnalysisDispatcher &getDependenceAnalyses(void) const;
+
   PDG *getPDG(void);
 
   noelle::CallGraph *getProgramCallGraph(void);
 
   void cleanAndEmbedPDGAsMetadata(PDG *pdg);
 
+  /*
+   * The PDG can be stored in a binary file next to the bitcode instead of
+   * being embedded in the IR (see PDGSidecar).
+   */
+  bool isPDGSidecarEnabled(void) const;
+
+  void cleanAndEmbedPDGAsSidecar(PDG *pdg);
+
+  /*
+   * Hash of the options and of the dependence and call graph analyses that
+   * decide which dependences this generator computes.
+   * Dependences stored in a sidecar file are reused only if they have been
+   * computed with the same configuration.
+   */
+  uint64_t computeConfigurationHash(void) const;
+
   void embedSCCAsMetadata(PDG *dg);
 
   virtual ~PDGGenerator();
@@ -102,14 +125,33 @@ private:
   bool disableSVFCallGraph;
   bool disableAllocAA;
   bool disableRA;
+  uint32_t numberOfThreads;
+  std::string sidecarFileName;
   PDGPrinter printer;
   noelle::CallGraph *noelleCG;
-  std::set<DependenceAnalysis *> ddAnalyses;
+  DependenceAnalysisDispatcher ddAnalyses;
   std::set<CallGraphAnalysis *> cgAnalyses;
   std::unordered_set<const Function *> internalFuncs;
   std::unordered_set<const Function *> unhandledExternalFuncs;
   std::unordered_map<const Function *, std::unordered_set<const Function *>>
       reachableUnhandledExternalFuncs;
+  DenseMap<Instruction *, Optional<MemoryLocation>> memoryLocations;
+  DenseMap<std::pair<MemoryLocation, MemoryLocation>, AliasResult>
+      aliasQueries;
+  uint64_t aliasQueryCacheHits;
+  uint64_t aliasQueryCacheMisses;
+  std::vector<Instruction *> memoryInstructions;
+  std::unordered_map<Instruction *, Value *> memoryBucketOf;
+  std::unordered_map<Value *, std::vector<Instruction *>> memoryBuckets;
+  std::vector<Instruction *> unknownMemoryBucket;
+  std::unordered_set<Function *> functionsWithReusedDependences;
+  uint64_t callPairsDisprovedByModRefSummaries;
+
+  /*
+   * Reachability within an iteration of a loop, indexed by the loop header
+   * (see canPrecedeInCurrentIteration).
+   */
+  std::unordered_map<BasicBlock *, CFGReachability> reachabilities;
 
   void identifyFunctionsThatInvokeUnhandledLibrary(Module &M);
   void printFunctionReachabilityResult();
@@ -118,6 +160,7 @@ private:
   bool isInternalFunctionThatReachUnhandledExternalFunction(const Function *F);
   bool cannotReachUnhandledExternalFunction(CallBase *call);
   bool hasNoMemoryOperations(CallBase *call);
+  static bool doesTheLibraryFunctionOnlyReadMemory(Function *libraryFunction);
 
   bool comparePDGs(PDG *pdg1, PDG *pdg2);
   bool compareNodes(PDG *pdg1, PDG *pdg2);
@@ -160,11 +203,42 @@ private:
   void trimDGUsingCustomAliasAnalysis(PDG *pdg);
 
   PDG *constructPDGFromAnalysis(Module &M);
+  PDG *constructPDGFromAnalysis(Module &M, PDGSidecar *sidecar);
+  void addDependencesFromSidecar(PDG *pdg, Module &M, PDGSidecar &sidecar);
+  bool hasReusedDependences(Function &F) const;
+  bool hasReusedDependences(Value *v) const;
   void constructEdgesFromUseDefs(PDG *pdg);
   void constructEdgesFromAliases(PDG *pdg, Module &M);
   void constructEdgesFromControl(PDG *pdg, Module &M);
   void constructEdgesFromAliasesForFunction(PDG *pdg, Function &F);
+  void constructEdgesFromAliasesForFunction(PDG *pdg,
+                                            Function &F,
+                                            DataFlowResult *dfr);
   void constructEdgesFromControlForFunction(PDG *pdg, Function &F);
+  DataFlowResult *computeReachableMemoryInstructions(Function &F);
+  void addControlDependences(
+      PDG *pdg,
+      std::vector<std::pair<Instruction *, Instruction *>> const
+          &controlDependences);
+  static std::vector<std::pair<Instruction *, Instruction *>>
+  computeControlDependences(Function &F, PostDominatorTree &postDomTree);
+
+  /*
+   * Parallel construction of the PDG.
+   *
+   * The dependences of each function are computed by a pool of threads into
+   * per-function buffers, which are then committed to the PDG by the calling
+   * thread.
+   * Alias queries go through the pass manager, which is not thread safe; for
+   * this reason, they are issued by the calling thread during the commit.
+   */
+  struct FunctionDependences {
+    std::vector<std::pair<Value *, Value *>> variableDependences;
+    std::vector<std::pair<Instruction *, Instruction *>> controlDependences;
+    DataFlowResult *reachableMemoryInstructions;
+  };
+  void constructEdgesInParallel(PDG *pdg, Module &M);
+  void computeFunctionDependences(Function &F, FunctionDependences &deps);
 
   void iterateInstForStore(PDG *,
                            Function &,
@@ -215,6 +289,53 @@ private:
                           Value *instI,
                           Value *instJ);
 
+  /*
+   * Alias queries between memory locations are cached per function.
+   */
+  AliasResult doTheyAlias(AAResults &AA,
+                          const MemoryLocation &memI,
+                          const MemoryLocation &memJ);
+  AliasResult doTheyAliasWithoutCache(AAResults &AA,
+                                      const MemoryLocation &memI,
+                                      const MemoryLocation &memJ);
+  Optional<MemoryLocation> getMemoryLocation(Instruction *inst);
+  void resetAliasQueryCache(void);
+
+  /*
+   * Memory instructions of a function are partitioned in buckets such that
+   * instructions of different buckets cannot alias.
+   */
+  void computeMemoryBuckets(Function &F);
+  void resetMemoryBuckets(void);
+  std::vector<Value *> getMemoryInstructionsThatCanConflictWith(
+      Instruction *inst,
+      DataFlowResult *dfr);
+
+  /*
+   * Mod/ref summaries of the functions of the program.
+   * They are the sets of abstract memory locations that a function (including
+   * its callees) can read and write.
+   * Every global variable accessed directly is an abstract memory location;
+   * the location 0 is any other memory location, so it overlaps with all of
+   * them.
+   */
+  struct ModRefSummary {
+    SparseBitVector<> reads;
+    SparseBitVector<> writes;
+  };
+  static constexpr unsigned unknownMemoryLocation = 0;
+  std::unordered_map<Function *, ModRefSummary> modRefSummaries;
+  std::unordered_map<GlobalVariable *, unsigned> abstractMemoryLocations;
+  bool modRefSummariesComputed;
+  ModRefSummary noModRefSummary;
+  ModRefSummary readOnlyModRefSummary;
+  ModRefSummary unknownModRefSummary;
+  void computeModRefSummaries(Module &M);
+  ModRefSummary computeModRefSummary(Function &F);
+  const ModRefSummary &getModRefSummary(CallBase *call);
+  bool canThereBeADependenceBetweenCalls(CallBase *call, CallBase *otherCall);
+  void resetModRefSummaries(void);
+
   bool edgeIsNotLoopCarriedMemoryDependency(DGEdge<Value, Value> *edge);
   bool isBackedgeIntoSameGlobal(DGEdge<Value, Value> *edge);
   bool isMemoryAccessIntoDifferentArrays(DGEdge<Value, Value> *edge);
@@ -240,6 +361,8 @@ private:
   static const StringSet<> externalFuncsHaveNoSideEffectOrHandledBySVF;
 
   static const StringSet<> externalThreadSafeFunctions;
+
+  static const StringSet<> externalFuncsThatOnlyReadMemory;
 };
 
 } // namespace arcana::noelle
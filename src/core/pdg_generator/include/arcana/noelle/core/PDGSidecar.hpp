@@ -0,0 +1,177 @@
+/*
+ * Copyright 2024  Simone Campanoni
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#ifndef NOELLE_SRC_CORE_PDG_ANALYSIS_PDGSIDECAR_H_
+#define NOELLE_SRC_CORE_PDG_ANALYSIS_PDGSIDECAR_H_
+
+#include "arcana/noelle/core/SystemHeaders.hpp"
+#include "arcana/noelle/core/FunctionSectionsFile.hpp"
+#include "arcana/noelle/core/PDG.hpp"
+
+namespace arcana::noelle {
+
+/*
+ * Binary file that stores the PDG of a module next to its bitcode.
+ *
+ * The dependences of the PDG are stored per function as all of them connect
+ * values of the same function, so the file is a FunctionSectionsFile.
+ * The words of its header are the hash of the configuration of the PDG
+ * generator that computed the dependences, the hash of the module, the hash
+ * of the global values of the module, and the hash of the summary of how the
+ * functions of the module access global memory.
+ *
+ * Nodes are not stored: node i of a function is the i-th value of the
+ * sequence composed by its arguments followed by its instructions.
+ * A section contains the number of nodes, the number of edges, and the edges
+ * sorted by source and destination.
+ * The source of an edge is stored as the (ULEB128) delta from the source of
+ * the previous edge.
+ * The destination is stored as the delta from the destination of the previous
+ * edge if they share the source, and as its node ID otherwise.
+ * Then, one byte encodes the attributes of the edge (see EdgeAttributes).
+ * If the edge has sub-edges, their number follows and then each sub-edge is
+ * stored with absolute node IDs and its own attributes.
+ *
+ * The dependences of a function can be loaded on their own if the function
+ * did not change since the file was written.
+ */
+class PDGSidecar {
+public:
+  /*
+   * Map @fileName.
+   */
+  PDGSidecar(const std::string &fileName);
+
+  PDGSidecar() = delete;
+
+  /*
+   * Check if the file exists and it is well formed.
+   */
+  bool isValid(void) const;
+
+  /*
+   * Check if the file stores the PDG of @M as it is now.
+   */
+  bool isUpToDate(Module &M) const;
+
+  /*
+   * Check if the dependences of the file have been computed with the
+   * configuration @configurationHash (see
+   * PDGGenerator::computeConfigurationHash).
+   * This is necessary for any dependence of the file to be reused, because
+   * the options and the dependence analyses of the generator decide which
+   * dependences are computed.
+   */
+  bool hasTheSameConfiguration(uint64_t configurationHash) const;
+
+  /*
+   * Check if the file has been generated for a module with the same global
+   * values of @M.
+   * This is necessary for any dependence of the file to be reused.
+   */
+  bool hasTheSameGlobals(Module &M) const;
+
+  /*
+   * Check if the file has been generated for a module whose functions access
+   * global memory as the functions of @M do (see computeMemorySummaryHash).
+   * This is necessary for any dependence of the file to be reused, because
+   * module-level alias analyses (e.g., GlobalsAA) answer the queries about a
+   * function using what the other functions do with the global variables.
+   */
+  bool hasTheSameMemorySummary(Module &M) const;
+
+  /*
+   * Check if the file stores the dependences of @F as it is now.
+   */
+  bool hasUpToDateDependences(Function &F) const;
+
+  /*
+   * Add the dependences of @F stored in the file to @pdg.
+   * Return false if the section of @F is corrupted (no dependence is added in
+   * this case).
+   */
+  bool addDependences(PDG *pdg, Function &F) const;
+
+  /*
+   * Load the PDG of @M computed with the configuration @configurationHash.
+   * Return nullptr if the file is not up to date.
+   */
+  PDG *loadPDG(Module &M, uint64_t configurationHash) const;
+
+  /*
+   * Store @pdg of @M, computed with the configuration @configurationHash,
+   * into @fileName.
+   * Return true if the file has been written.
+   */
+  static bool write(PDG *pdg,
+                    Module &M,
+                    uint64_t configurationHash,
+                    const std::string &fileName);
+
+  /*
+   * Hash of how the functions and the global variables of @M use the global
+   * variables of @M: for each use, whether the global is loaded, stored (and
+   * what kind of pointer is stored into it), or its address escapes.
+   */
+  static uint64_t computeMemorySummaryHash(Module &M);
+
+  /*
+   * Hash of @M.
+   */
+  static uint64_t computeModuleHash(Module &M);
+
+private:
+  enum EdgeAttributes : uint8_t {
+    KIND_MASK = 0x3,
+    KIND_VARIABLE = 0x0,
+    KIND_MAY_MEMORY = 0x1,
+    KIND_MUST_MEMORY = 0x2,
+    KIND_CONTROL = 0x3,
+    DATA_DEPENDENCE_SHIFT = 2,
+    DATA_DEPENDENCE_MASK = 0x3 << DATA_DEPENDENCE_SHIFT,
+    LOOP_CARRIED = 0x1 << 4,
+    HAS_SUB_EDGES = 0x1 << 5
+  };
+
+  enum HeaderWord : uint32_t {
+    CONFIGURATION_HASH,
+    MODULE_HASH,
+    GLOBALS_HASH,
+    MEMORY_SUMMARY_HASH,
+    NUMBER_OF_HEADER_WORDS
+  };
+
+  std::string fileName;
+  FunctionSectionsFile file;
+
+  static const char magic[8];
+  static const uint32_t version;
+
+  static std::vector<Value *> getNodes(Function &F);
+
+  static uint8_t getAttributes(DGEdge<Value, Value> *edge);
+
+  static void writeFunction(PDG *pdg, Function &F, raw_ostream &out);
+};
+
+} // namespace arcana::noelle
+
+#endif // NOELLE_SRC_CORE_PDG_ANALYSIS_PDGSIDECAR_H_
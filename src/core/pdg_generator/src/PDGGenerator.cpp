@@ -19,6 +19,8 @@
  OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
  OR OTHER DEALINGS IN THE SOFTWARE.
  */
+#include <chrono>
+
 #include "arcana/noelle/core/SystemHeaders.hpp"
 #include "arcana/noelle/core/TalkDown.hpp"
 #include "arcana/noelle/core/PDGPrinter.hpp"
@@ -40,7 +42,9 @@ PDGGenerator::PDGGenerator(
     bool disableSVFCallGraph,
     bool disableAllocAA,
     bool disableRA,
-    PDGVerbosity verbose)
+    PDGVerbosity verbose,
+    uint32_t numberOfThreads,
+    std::string sidecarFileName)
   : M{ M },
     getSCEV{ getSCEV },
     getLoopInfo{ getLoopInfo },
@@ -57,8 +61,18 @@ PDGGenerator::PDGGenerator(
     disableSVFCallGraph{ disableSVFCallGraph },
     disableAllocAA{ disableAllocAA },
     disableRA{ disableRA },
+    numberOfThreads{ numberOfThreads },
+    sidecarFileName{ sidecarFileName },
     printer{},
-    noelleCG{ nullptr } {
+    noelleCG{ nullptr },
+    aliasQueryCacheHits{ 0 },
+    aliasQueryCacheMisses{ 0 },
+    callPairsDisprovedByModRefSummaries{ 0 } {
+
+  /*
+   * No function has been summarized yet.
+   */
+  this->resetModRefSummaries();
 
   /*
    * Function reachability analysis.
@@ -125,9 +139,34 @@ PDG *PDGGenerator::getPDG(void) {
   /*
    * Construct the PDG
    *
-   * Check if we have already done it and the PDG has been embedded in the IR.
-   */
-  if (this->hasPDGAsMetadata(this->M)) {
+   * Check if we have already done it and the PDG has been stored in a sidecar
+   * file.
+   */
+  std::unique_ptr<PDGSidecar> sidecar{ nullptr };
+  auto isSidecarUpToDate = false;
+  if (this->isPDGSidecarEnabled()) {
+    sidecar = std::make_unique<PDGSidecar>(this->sidecarFileName);
+    this->programDependenceGraph =
+        sidecar->loadPDG(this->M, this->computeConfigurationHash());
+    isSidecarUpToDate = (this->programDependenceGraph != nullptr);
+    if (isSidecarUpToDate && (verbose >= PDGVerbosity::Minimal)) {
+      errs() << "PDGGenerator: Load the PDG from " << this->sidecarFileName
+             << "\n";
+    }
+  }
+  if (this->programDependenceGraph != nullptr) {
+    if (this->performThePDGComparison) {
+      auto PDGFromAnalysis = this->constructPDGFromAnalysis(this->M);
+      auto arePDGsEquivalent =
+          this->comparePDGs(PDGFromAnalysis, this->programDependenceGraph);
+      if (!arePDGsEquivalent) {
+        errs() << "PDGGenerator: Error = PDGs constructed are not the same\n";
+        abort();
+      }
+      delete PDGFromAnalysis;
+    }
+
+  } else if (this->hasPDGAsMetadata(this->M)) {
 
     /*
      * The PDG has been embedded in the IR.
@@ -152,8 +191,11 @@ PDG *PDGGenerator::getPDG(void) {
      * There is no PDG in the IR.
      *
      * Compute the PDG using the dependence analyses.
+     * If the sidecar file stores the dependences of a previous version of the
+     * module, reuse those of the functions that did not change.
      */
-    this->programDependenceGraph = constructPDGFromAnalysis(this->M);
+    this->programDependenceGraph =
+        this->constructPDGFromAnalysis(this->M, sidecar.get());
 
     /*
      * Check if we should embed the PDG.
@@ -170,6 +212,17 @@ PDG *PDGGenerator::getPDG(void) {
     }
   }
 
+  /*
+   * Store the PDG for the next invocations.
+   */
+  if ((sidecar != nullptr) && (!isSidecarUpToDate)) {
+    sidecar.reset();
+    PDGSidecar::write(this->programDependenceGraph,
+                      this->M,
+                      this->computeConfigurationHash(),
+                      this->sidecarFileName);
+  }
+
   /*
    * Print the PDG
    */
@@ -185,17 +238,48 @@ PDG *PDGGenerator::getPDG(void) {
 }
 
 PDG *PDGGenerator::constructPDGFromAnalysis(Module &M) {
+  return this->constructPDGFromAnalysis(M, nullptr);
+}
+
+PDG *PDGGenerator::constructPDGFromAnalysis(Module &M, PDGSidecar *sidecar) {
   if (verbose >= PDGVerbosity::Maximal) {
     errs() << "PDGGenerator: Construct PDG from Analysis\n";
   }
 
   auto pdg = new PDG(M);
 
-  constructEdgesFromUseDefs(pdg);
-  constructEdgesFromAliases(pdg, M);
-  constructEdgesFromControl(pdg, M);
+  /*
+   * Reuse the dependences stored in the sidecar file.
+   */
+  this->functionsWithReusedDependences.clear();
+  if (sidecar != nullptr) {
+    this->addDependencesFromSidecar(pdg, M, *sidecar);
+  }
+
+  /*
+   * Summarize the memory locations accessed by the functions to avoid
+   * querying the alias analyses about pairs of calls that cannot conflict.
+   */
+  this->computeModRefSummaries(M);
+
+  if (this->numberOfThreads > 1) {
+    constructEdgesInParallel(pdg, M);
+  } else {
+    constructEdgesFromUseDefs(pdg);
+    constructEdgesFromAliases(pdg, M);
+    constructEdgesFromControl(pdg, M);
+  }
+  if (verbose >= PDGVerbosity::Minimal) {
+    errs() << "PDGGenerator:   Alias queries between memory locations: "
+           << this->aliasQueryCacheHits << " cache hits, "
+           << this->aliasQueryCacheMisses << " cache misses\n";
+    errs() << "PDGGenerator:   Pairs of calls disproved by mod/ref summaries: "
+           << this->callPairsDisprovedByModRefSummaries << "\n";
+  }
+  this->resetModRefSummaries();
 
   trimDGUsingCustomAliasAnalysis(pdg);
+  this->functionsWithReusedDependences.clear();
 
   return pdg;
 }
@@ -211,10 +295,13 @@ void PDGGenerator::trimDGUsingCustomAliasAnalysis(PDG *pdg) {
 
   /*
    * Invoke AllocAA
-   * Fetch and invoke MayPointsToAnalysis
+   * Fetch and invoke MayPointsToAnalysis, which summarizes the functions of
+   * the program call graph first.
    */
-  this->mpa = MayPointsToAnalysis{};
+  this->mpa =
+      MayPointsToAnalysis{ this->getProgramCallGraph(), this->numberOfThreads };
   removeEdgesNotUsedByParSchemes(pdg);
+  this->reachabilities.clear();
 
   /*
    * Invoke the TalkDown
@@ -240,6 +327,13 @@ void PDGGenerator::constructEdgesFromUseDefs(PDG *pdg) {
       continue;
     }
 
+    /*
+     * Check if the dependences of the current definition have been reused.
+     */
+    if (this->hasReusedDependences(pdgValue)) {
+      continue;
+    }
+
     /*
      * The current definition has uses.
      * Add the uses.
@@ -270,6 +364,13 @@ void PDGGenerator::constructEdgesFromAliases(PDG *pdg, Module &M) {
     if (F.empty())
       continue;
 
+    /*
+     * Check if the dependences of the function have been reused.
+     */
+    if (this->hasReusedDependences(F)) {
+      continue;
+    }
+
     /*
      * Add the edges to the PDG.
      */
@@ -282,13 +383,22 @@ void PDGGenerator::constructEdgesFromAliases(PDG *pdg, Module &M) {
 void PDGGenerator::constructEdgesFromAliasesForFunction(PDG *pdg, Function &F) {
 
   /*
-   * Fetch the alias analysis.
+   * Run the reachable analysis.
    */
-  auto &AA = this->getAA(F);
+  auto dfr = this->computeReachableMemoryInstructions(F);
 
   /*
-   * Run the reachable analysis.
+   * Add the memory dependences.
    */
+  this->constructEdgesFromAliasesForFunction(pdg, F, dfr);
+
+  /*
+   * Free the memory.
+   */
+  delete dfr;
+}
+
+DataFlowResult *PDGGenerator::computeReachableMemoryInstructions(Function &F) {
   auto onlyMemoryInstructionFilter = [](Instruction *i) -> bool {
     if (isa<LoadInst>(i)) {
       return true;
@@ -306,6 +416,30 @@ void PDGGenerator::constructEdgesFromAliasesForFunction(PDG *pdg, Function &F) {
           ? this->dfa.getFullSets(&F)
           : this->dfa.runReachableAnalysis(&F, onlyMemoryInstructionFilter);
 
+  return dfr;
+}
+
+void PDGGenerator::constructEdgesFromAliasesForFunction(PDG *pdg,
+                                                        Function &F,
+                                                        DataFlowResult *dfr) {
+
+  /*
+   * Fetch the alias analysis.
+   */
+  auto &AA = this->getAA(F);
+
+  /*
+   * Alias queries answered for other functions cannot be reused.
+   */
+  this->resetAliasQueryCache();
+
+  /*
+   * Partition the memory instructions to avoid checking pairs of instructions
+   * that access different objects.
+   */
+  auto startTime = std::chrono::steady_clock::now();
+  this->computeMemoryBuckets(F);
+
   for (auto &B : F) {
     for (auto &I : B) {
 
@@ -329,10 +463,28 @@ void PDGGenerator::constructEdgesFromAliasesForFunction(PDG *pdg, Function &F) {
     }
   }
 
+  /*
+   * Print the time spent on the function.
+   */
+  if (verbose >= PDGVerbosity::Maximal) {
+    auto endTime = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+                       endTime - startTime)
+                       .count();
+    errs() << "PDGGenerator:   Memory dependences of " << F.getName() << ": "
+           << (this->memoryBucketOf.size() + this->unknownMemoryBucket.size())
+           << " memory instructions, " << this->memoryBuckets.size()
+           << " object buckets, " << this->unknownMemoryBucket.size()
+           << " instructions in the unknown bucket, " << elapsed << " us\n";
+  }
+
   /*
    * Free the memory.
    */
-  delete dfr;
+  this->resetAliasQueryCache();
+  this->resetMemoryBuckets();
+
+  return;
 }
 
 void PDGGenerator::removeEdgesNotUsedByParSchemes(PDG *pdg) {
@@ -646,47 +798,38 @@ bool PDGGenerator::isMemoryAccessIntoDifferentArrays(
 
 bool PDGGenerator::canPrecedeInCurrentIteration(Instruction *from,
                                                 Instruction *to) {
-  auto &LI = this->getLoopInfo(*from->getFunction());
-  BasicBlock *fromBB = from->getParent();
-  BasicBlock *toBB = to->getParent();
-  auto loop = LI.getLoopFor(fromBB);
-  BasicBlock *headerBB = nullptr;
-  if (loop)
-    headerBB = loop->getHeader();
 
-  if (fromBB == toBB) {
-    for (auto &I : *fromBB) {
-      if (&I == from)
-        return true;
-      if (&I == to)
-        return false;
-    }
+  /*
+   * An instruction precedes itself.
+   * This is not a question of reachability: CFGReachability would answer
+   * whether @from can execute again in the same iteration, which holds only
+   * if its basic block is in a cycle (e.g., of an inner loop).
+   */
+  if (from == to) {
+    return true;
   }
 
-  std::queue<BasicBlock *> bbToTraverse;
-  std::set<BasicBlock *> bbReached;
-  auto traverseOn = [&](BasicBlock *bb) -> void {
-    bbToTraverse.push(bb);
-    bbReached.insert(bb);
-  };
-  traverseOn(toBB);
-
-  while (!bbToTraverse.empty()) {
-    auto bb = bbToTraverse.front();
-    bbToTraverse.pop();
-    if (bb == fromBB)
-      return true;
-    if (bb == headerBB)
-      continue;
-
-    for (auto predBB : make_range(pred_begin(bb), pred_end(bb))) {
-      if (bbReached.find(predBB) == bbReached.end()) {
-        traverseOn(predBB);
-      }
-    }
+  /*
+   * Fetch the innermost loop that contains @from.
+   */
+  auto f = from->getFunction();
+  auto &LI = this->getLoopInfo(*f);
+  auto loop = LI.getLoopFor(from->getParent());
+  BasicBlock *headerBB = nullptr;
+  if (loop) {
+    headerBB = loop->getHeader();
   }
 
-  return false;
+  /*
+   * Fetch the reachability within an iteration of that loop.
+   * The entry block cannot be a loop header, so it identifies the
+   * reachability of @from when it is not in a loop.
+   */
+  auto key = (headerBB != nullptr) ? headerBB : &f->getEntryBlock();
+  auto &reachability =
+      this->reachabilities.try_emplace(key, *f, headerBB).first->second;
+
+  return reachability.canReach(from, to);
 }
 
 bool PDGGenerator::edgeIsAlongNonMemoryWritingFunctions(
@@ -784,11 +927,16 @@ bool PDGGenerator::edgeIsAlongNonMemoryWritingFunctions(
 }
 
 void PDGGenerator::addAnalysis(DependenceAnalysis *a) {
-  this->ddAnalyses.insert(a);
+  this->ddAnalyses.addAnalysis(a);
 
   return;
 }
 
+const DependenceAnalysisDispatcher &PDGGenerator::getDependenceAnalyses(
+    void) const {
+  return this->ddAnalyses;
+}
+
 void PDGGenerator::addAnalysis(CallGraphAnalysis *a) {
   this->cgAnalyses.insert(a);
 }
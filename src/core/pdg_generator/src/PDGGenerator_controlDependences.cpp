@@ -38,6 +38,9 @@ void PDGGenerator::constructEdgesFromControl(PDG *pdg, Module &M) {
     if (F.empty()) {
       continue;
     }
+    if (this->hasReusedDependences(F)) {
+      continue;
+    }
 
     /*
      * Compute the control dependences of the function based on its
@@ -53,17 +56,57 @@ void PDGGenerator::constructEdgesFromControlForFunction(PDG *pdg, Function &F) {
   assert(pdg != nullptr);
 
   /*
-   * There is a control dependence from a basic block A to a basic block B iff
-   * 1) there is E such that E is a successor of A, and
-   * 2) B post-dominates E, and
-   * 3) B doesn't strictly post-dominate A
+   * Fetch the post-dominator tree of the function.
    */
+  auto &postDomTree = this->getPDT(F);
 
   /*
-   * Fetch the post-dominator tree of the function.
+   * Compute the control dependences of the function.
    */
-  auto &postDomTree = this->getPDT(F);
+  auto controlDependences =
+      PDGGenerator::computeControlDependences(F, postDomTree);
+
+  /*
+   * Add the control dependences to the PDG.
+   */
+  this->addControlDependences(pdg, controlDependences);
+
+  return;
+}
+
+void PDGGenerator::addControlDependences(
+    PDG *pdg,
+    std::vector<std::pair<Instruction *, Instruction *>> const
+        &controlDependences) {
+  assert(pdg != nullptr);
 
+  for (auto &dependence : controlDependences) {
+    auto srcNode = pdg->fetchNode(dependence.first);
+    auto dstNode = pdg->fetchNode(dependence.second);
+    assert(srcNode != nullptr);
+    assert(dstNode != nullptr);
+    ControlDependence<Value, Value> edge{ srcNode, dstNode };
+    pdg->copyAddEdge(edge);
+  }
+
+  return;
+}
+
+std::vector<std::pair<Instruction *, Instruction *>> PDGGenerator::
+    computeControlDependences(Function &F, PostDominatorTree &postDomTree) {
+  std::vector<std::pair<Instruction *, Instruction *>> controlDependences;
+
+  /*
+   * There is a control dependence from a basic block A to a basic block B iff
+   * 1) there is E such that E is a successor of A, and
+   * 2) B post-dominates E, and
+   * 3) B doesn't strictly post-dominate A
+   *
+   * This function only reads the IR and @postDomTree, so it can run
+   * concurrently on different functions.
+   */
+  std::unordered_map<Instruction *, std::unordered_set<Instruction *>>
+      controlProducers;
   for (auto &B : F) {
 
     /*
@@ -124,29 +167,13 @@ void PDGGenerator::constructEdgesFromControlForFunction(PDG *pdg, Function &F) {
          * Add the control dependences.
          */
         for (auto &I : B) {
-          auto srcNode = pdg->fetchNode(controlTerminator);
-          auto dstNode = pdg->fetchNode(&I);
-          assert(srcNode != nullptr);
-          assert(dstNode != nullptr);
-          ControlDependence<Value, Value> edge{ srcNode, dstNode };
-          pdg->copyAddEdge(edge);
+          controlDependences.push_back(std::make_pair(controlTerminator, &I));
+          controlProducers[&I].insert(controlTerminator);
         }
       }
     }
   }
 
-  auto getControlProducers = [&](Value *V) -> std::unordered_set<Value *> {
-    std::unordered_set<Value *> controlProducers;
-    auto node = pdg->fetchNode(V);
-    for (auto edge : node->getIncomingEdges()) {
-      if (!isa<ControlDependence<Value, Value>>(edge))
-        continue;
-      auto controlProducer = edge->getSrc();
-      controlProducers.insert(controlProducer);
-    }
-    return controlProducers;
-  };
-
   /*
    * For PHI nodes with incoming values that do not reside in their respective
    * incoming block, add control edges on the incoming block's terminator to the
@@ -159,7 +186,7 @@ void PDGGenerator::constructEdgesFromControlForFunction(PDG *pdg, Function &F) {
        * Locate control producers of incoming blocks to PHIs
        * where the incoming value doesn't reside in incoming block
        */
-      std::unordered_set<Value *> controlProducers;
+      std::unordered_set<Instruction *> producers;
       for (auto i = 0u; i < phi.getNumIncomingValues(); ++i) {
         auto incomingValue = phi.getIncomingValue(i);
         if (!incomingValue)
@@ -171,36 +198,29 @@ void PDGGenerator::constructEdgesFromControlForFunction(PDG *pdg, Function &F) {
           continue;
 
         auto terminator = incomingBlock->getTerminator();
-        auto terminatorControlProducers = getControlProducers(terminator);
-        controlProducers.insert(terminatorControlProducers.begin(),
-                                terminatorControlProducers.end());
+        auto &terminatorControlProducers = controlProducers[terminator];
+        producers.insert(terminatorControlProducers.begin(),
+                         terminatorControlProducers.end());
       }
-      if (controlProducers.size() == 0)
+      if (producers.size() == 0)
         continue;
 
       /*
        * Determine which of these control producers do NOT have a control edge
        * to the PHI already Add a control edge from those producers to the PHI
        */
-      std::unordered_set<Value *> currentControlProducersOnPHI =
-          getControlProducers(&phi);
-      for (auto producer : controlProducers) {
+      auto &currentControlProducersOnPHI = controlProducers[&phi];
+      for (auto producer : producers) {
         if (currentControlProducersOnPHI.find(producer)
             != currentControlProducersOnPHI.end()) {
           continue;
         }
-
-        auto srcNode = pdg->fetchNode(producer);
-        auto dstNode = pdg->fetchNode(&phi);
-        assert(srcNode != nullptr);
-        assert(dstNode != nullptr);
-        ControlDependence<Value, Value> edge{ srcNode, dstNode };
-        pdg->copyAddEdge(edge);
+        controlDependences.push_back(std::make_pair(producer, &phi));
       }
     }
   }
 
-  return;
+  return controlDependences;
 }
 
 } // namespace arcana::noelle
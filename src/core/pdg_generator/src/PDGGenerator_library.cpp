@@ -35,6 +35,15 @@ bool PDGGenerator::isTheLibraryFunctionPure(Function *libraryFunction) {
   return false;
 }
 
+bool PDGGenerator::doesTheLibraryFunctionOnlyReadMemory(
+    Function *libraryFunction) {
+  if (PDGGenerator::externalFuncsThatOnlyReadMemory.count(
+          libraryFunction->getName())) {
+    return true;
+  }
+  return false;
+}
+
 bool PDGGenerator::isTheLibraryFunctionThreadSafe(Function *libraryFunction) {
   if (PDGGenerator::externalThreadSafeFunctions.count(
           libraryFunction->getName())) {
@@ -170,4 +179,60 @@ const StringSet<> PDGGenerator::externalThreadSafeFunctions{
 
 };
 
+// Library functions that can read memory, but they never write memory visible
+// to the program (not even errno).
+const StringSet<> PDGGenerator::externalFuncsThatOnlyReadMemory{
+
+  // ctype.h
+  "isalnum",
+  "isalpha",
+  "isblank",
+  "iscntrl",
+  "isdigit",
+  "isgraph",
+  "islower",
+  "isprint",
+  "ispunct",
+  "isspace",
+  "isupper",
+  "isxdigit",
+  "tolower",
+  "toupper",
+
+  // string.h
+  "memchr",
+  "memcmp",
+  "strchr",
+  "strcmp",
+  "strcspn",
+  "strlen",
+  "strncmp",
+  "strnlen",
+  "strpbrk",
+  "strrchr",
+  "strspn",
+  "strstr",
+
+  // wctype.h
+  "iswalnum",
+  "iswalpha",
+  "iswblank",
+  "iswcntrl",
+  "iswdigit",
+  "iswgraph",
+  "iswlower",
+  "iswprint",
+  "iswpunct",
+  "iswspace",
+  "iswupper",
+  "iswxdigit",
+  "towlower",
+  "towupper",
+  "iswctype",
+  "towctrans",
+
+  "abs",
+  "difftime"
+};
+
 } // namespace arcana::noelle
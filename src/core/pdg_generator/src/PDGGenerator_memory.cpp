@@ -35,22 +35,9 @@ bool PDGGenerator::canThereBeAMemoryDataDependence(Instruction *fromInst,
   /*
    * Check if any of the data dependence analyses can assert the lack of
    * dependence from @fromInst to @toInst.
+   * If none can, we must assume this dependence can happen at run time.
    */
-  for (auto ddAnalysis : this->ddAnalyses) {
-    if (!ddAnalysis->canThereBeAMemoryDataDependence(fromInst, toInst, F)) {
-
-      /*
-       * We found a dependence analysis that can assert the lack of dependence.
-       */
-      return false;
-    }
-  }
-
-  /*
-   * We did not find a single dependence analysis that can assert the lack of
-   * dependence. So we must assume this dependence can happen at run time.
-   */
-  return true;
+  return this->ddAnalyses.canThereBeAMemoryDataDependence(fromInst, toInst, F);
 }
 
 std::pair<bool, bool> PDGGenerator::isThereThisMemoryDataDependenceType(
@@ -58,21 +45,12 @@ std::pair<bool, bool> PDGGenerator::isThereThisMemoryDataDependenceType(
     Instruction *fromInst,
     Instruction *toInst,
     Function &F) {
-  auto noDep = false;
-  auto mustExist = false;
-
-  for (auto ddAnalysis : this->ddAnalyses) {
-    auto resp =
-        ddAnalysis->isThereThisMemoryDataDependenceType(t, fromInst, toInst, F);
-    if (resp == CANNOT_EXIST) {
-      noDep = true;
-      break;
-    }
-    if (resp == MUST_EXIST) {
-      mustExist = true;
-      break;
-    }
-  }
+  auto resp = this->ddAnalyses.isThereThisMemoryDataDependenceType(t,
+                                                                   fromInst,
+                                                                   toInst,
+                                                                   F);
+  auto noDep = (resp == CANNOT_EXIST);
+  auto mustExist = (resp == MUST_EXIST);
 
   return std::make_pair(noDep, mustExist);
 }
@@ -83,7 +61,7 @@ void PDGGenerator::iterateInstForStore(PDG *pdg,
                                        DataFlowResult *dfr,
                                        StoreInst *store) {
 
-  for (auto I : dfr->OUT(store)) {
+  for (auto I : this->getMemoryInstructionsThatCanConflictWith(store, dfr)) {
 
     /*
      * Check if the instruction can access memory.
@@ -143,7 +121,7 @@ void PDGGenerator::iterateInstForLoad(PDG *pdg,
                                       DataFlowResult *dfr,
                                       LoadInst *load) {
 
-  for (auto I : dfr->OUT(load)) {
+  for (auto I : this->getMemoryInstructionsThatCanConflictWith(load, dfr)) {
 
     /*
      * Check if the instruction can access memory.
@@ -216,7 +194,7 @@ void PDGGenerator::iterateInstForCall(PDG *pdg,
   /*
    * Identify all dependences from @call.
    */
-  for (auto I : dfr->OUT(call)) {
+  for (auto I : this->getMemoryInstructionsThatCanConflictWith(call, dfr)) {
 
     /*
      * Check if the instruction can access memory.
@@ -646,6 +624,14 @@ void PDGGenerator::addEdgeFromFunctionModRef(
     return;
   }
 
+  /*
+   * Check if the memory locations accessed by the two calls can overlap.
+   */
+  if (!this->canThereBeADependenceBetweenCalls(call, otherCall)) {
+    this->callPairsDisprovedByModRefSummaries++;
+    return;
+  }
+
   /*
    * Check if the call instructions are about an allocator and a deallocator.
    */
@@ -1298,34 +1284,22 @@ AliasResult PDGGenerator::doTheyAlias(PDG *pdg,
 
   /*
    * Check if the parameters have memory locations.
+   * If they do, the query is about the memory locations accessed.
    */
-  auto haveMemoryLocations = false;
   auto instIAsInst = dyn_cast<Instruction>(instI);
   auto instJAsInst = dyn_cast<Instruction>(instJ);
   if ((instIAsInst != nullptr) && (instJAsInst != nullptr)) {
-    if (MemoryLocation::getOrNone(instIAsInst)
-        && MemoryLocation::getOrNone(instJAsInst)) {
-      haveMemoryLocations = true;
+    auto memI = this->getMemoryLocation(instIAsInst);
+    auto memJ = this->getMemoryLocation(instJAsInst);
+    if (memI && memJ) {
+      return this->doTheyAlias(AA, *memI, *memJ);
     }
   }
 
   /*
    * Query the LLVM alias analyses.
    */
-  AliasResult aaResult{ AliasResult::MayAlias };
-  if (haveMemoryLocations) {
-    auto memI = MemoryLocation::get(instIAsInst);
-    auto memJ = MemoryLocation::get(instJAsInst);
-    auto areTheSame = memI == memJ;
-    if (areTheSame) {
-      aaResult = AliasResult::MustAlias;
-    } else {
-      aaResult = AA.alias(memI, memJ);
-    }
-
-  } else {
-    aaResult = AA.alias(instI, instJ);
-  }
+  auto aaResult = AA.alias(instI, instJ);
   switch (aaResult) {
     case AliasResult::NoAlias:
       return AliasResult::NoAlias;
@@ -1346,34 +1320,144 @@ AliasResult PDGGenerator::doTheyAlias(PDG *pdg,
     /*
      * SVF is disabled.
      */
+    return AliasResult::MayAlias;
+  }
 
-  } else {
+  /*
+   * SVF is enabled, so let's use it.
+   */
+  switch (NoelleSVFIntegration::alias(instI, instJ)) {
+    case AliasResult::NoAlias:
+      return AliasResult::NoAlias;
+    case AliasResult::PartialAlias:
+    case AliasResult::MayAlias:
+      break;
+    case AliasResult::MustAlias:
+      return AliasResult::MustAlias;
+  }
+
+  return AliasResult::MayAlias;
+}
+
+AliasResult PDGGenerator::doTheyAlias(AAResults &AA,
+                                      const MemoryLocation &memI,
+                                      const MemoryLocation &memJ) {
+
+  /*
+   * Check trivial cases.
+   */
+  if (memI == memJ) {
+    return AliasResult::MustAlias;
+  }
+
+  /*
+   * Check if we have already answered this query.
+   *
+   * The answer is symmetric, so the pair is stored in a canonical order.
+   */
+  auto isMemIFirst = std::make_tuple(memI.Ptr,
+                                     memI.Size.toRaw(),
+                                     memI.AATags.TBAA,
+                                     memI.AATags.TBAAStruct,
+                                     memI.AATags.Scope,
+                                     memI.AATags.NoAlias)
+                     < std::make_tuple(memJ.Ptr,
+                                       memJ.Size.toRaw(),
+                                       memJ.AATags.TBAA,
+                                       memJ.AATags.TBAAStruct,
+                                       memJ.AATags.Scope,
+                                       memJ.AATags.NoAlias);
+  auto query =
+      isMemIFirst ? std::make_pair(memI, memJ) : std::make_pair(memJ, memI);
+  auto cachedResult = this->aliasQueries.find(query);
+  if (cachedResult != this->aliasQueries.end()) {
+    this->aliasQueryCacheHits++;
+    return cachedResult->second;
+  }
+  this->aliasQueryCacheMisses++;
+
+  /*
+   * Query the alias analyses.
+   */
+  auto aaResult = this->doTheyAliasWithoutCache(AA, memI, memJ);
+  this->aliasQueries.insert(std::make_pair(query, aaResult));
+
+  return aaResult;
+}
+
+AliasResult PDGGenerator::doTheyAliasWithoutCache(AAResults &AA,
+                                                  const MemoryLocation &memI,
+                                                  const MemoryLocation &memJ) {
+
+  /*
+   * Query the LLVM alias analyses.
+   */
+  auto aaResult = AA.alias(memI, memJ);
+  switch (aaResult) {
+    case AliasResult::NoAlias:
+      return AliasResult::NoAlias;
+    case AliasResult::PartialAlias:
+    case AliasResult::MayAlias:
+      break;
+    case AliasResult::MustAlias:
+      return AliasResult::MustAlias;
+  }
+
+  /*
+   * Check other alias analyses
+   *
+   * Check if SVF is enabled.
+   */
+  if (this->disableSVF) {
 
     /*
-     * SVF is enabled, so let's use it.
+     * SVF is disabled.
      */
-    AliasResult SVFAAResult{ AliasResult::MayAlias };
-    if (haveMemoryLocations) {
-      SVFAAResult =
-          NoelleSVFIntegration::alias(MemoryLocation::get(instIAsInst),
-                                      MemoryLocation::get(instJAsInst));
-    } else {
-      SVFAAResult = NoelleSVFIntegration::alias(instI, instJ);
-    }
-    switch (SVFAAResult) {
-      case AliasResult::NoAlias:
-        return AliasResult::NoAlias;
-      case AliasResult::PartialAlias:
-      case AliasResult::MayAlias:
-        break;
-      case AliasResult::MustAlias:
-        return AliasResult::MustAlias;
-    }
+    return AliasResult::MayAlias;
+  }
+
+  /*
+   * SVF is enabled, so let's use it.
+   */
+  switch (NoelleSVFIntegration::alias(memI, memJ)) {
+    case AliasResult::NoAlias:
+      return AliasResult::NoAlias;
+    case AliasResult::PartialAlias:
+    case AliasResult::MayAlias:
+      break;
+    case AliasResult::MustAlias:
+      return AliasResult::MustAlias;
   }
 
   return AliasResult::MayAlias;
 }
 
+Optional<MemoryLocation> PDGGenerator::getMemoryLocation(Instruction *inst) {
+
+  /*
+   * Check if we have already computed the memory location of @inst.
+   */
+  auto it = this->memoryLocations.find(inst);
+  if (it != this->memoryLocations.end()) {
+    return it->second;
+  }
+
+  /*
+   * Compute the memory location.
+   */
+  auto memLoc = MemoryLocation::getOrNone(inst);
+  this->memoryLocations.insert(std::make_pair(inst, memLoc));
+
+  return memLoc;
+}
+
+void PDGGenerator::resetAliasQueryCache(void) {
+  this->memoryLocations.clear();
+  this->aliasQueries.clear();
+
+  return;
+}
+
 bool PDGGenerator::canAccessMemory(Instruction *i) {
 
   /*
@@ -0,0 +1,145 @@
+/*
+ * Copyright 2024  Simone Campanoni
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "arcana/noelle/core/SystemHeaders.hpp"
+#include "arcana/noelle/core/PDGGenerator.hpp"
+#include "llvm/Analysis/ValueTracking.h"
+
+namespace arcana::noelle {
+
+void PDGGenerator::computeMemoryBuckets(Function &F) {
+  this->resetMemoryBuckets();
+
+  /*
+   * Partition the loads and stores of @F based on the object they access.
+   *
+   * Two accesses to different identified objects (e.g., allocas, globals,
+   * results of allocators, noalias arguments) cannot alias.
+   * So every identified object gets its own bucket.
+   * Accesses for which we cannot identify the object, as well as calls, go to
+   * the unknown bucket, which is compatible with all buckets.
+   */
+  for (auto &I : instructions(F)) {
+    if (!PDGGenerator::canAccessMemory(&I)) {
+      continue;
+    }
+    this->memoryInstructions.push_back(&I);
+
+    /*
+     * Fetch the pointer accessed by @I.
+     */
+    Value *pointer = nullptr;
+    if (auto load = dyn_cast<LoadInst>(&I)) {
+      pointer = load->getPointerOperand();
+    } else if (auto store = dyn_cast<StoreInst>(&I)) {
+      pointer = store->getPointerOperand();
+    }
+
+    /*
+     * Fetch the object accessed by @I.
+     */
+    Value *object = nullptr;
+    if (pointer != nullptr) {
+      auto underlyingObject = getUnderlyingObject(pointer);
+      if (isIdentifiedObject(underlyingObject)) {
+        object = const_cast<Value *>(underlyingObject);
+      }
+    }
+
+    /*
+     * Add @I to its bucket.
+     */
+    if (object == nullptr) {
+      this->unknownMemoryBucket.push_back(&I);
+      continue;
+    }
+    this->memoryBucketOf[&I] = object;
+    this->memoryBuckets[object].push_back(&I);
+  }
+
+  return;
+}
+
+void PDGGenerator::resetMemoryBuckets(void) {
+  this->memoryInstructions.clear();
+  this->memoryBucketOf.clear();
+  this->memoryBuckets.clear();
+  this->unknownMemoryBucket.clear();
+
+  return;
+}
+
+std::vector<Value *> PDGGenerator::getMemoryInstructionsThatCanConflictWith(
+    Instruction *inst,
+    DataFlowResult *dfr) {
+  std::vector<Value *> candidates;
+
+  /*
+   * Fetch the memory instructions reachable from @inst as a bit vector, so
+   * each candidate costs a bit test.
+   * Without a bit-vector result (i.e., the reachability analysis is
+   * disabled), every memory instruction is considered reachable.
+   */
+  auto bitVectorResult = dfr->getBitVectorResult();
+  const BitVector *reachable = nullptr;
+  if (bitVectorResult != nullptr) {
+    reachable = &bitVectorResult->OUT(inst);
+  }
+  auto keepReachable = [bitVectorResult, reachable, &candidates](
+                           Instruction *other) {
+    if (reachable != nullptr) {
+      if (!bitVectorResult->isInUniverse(other)) {
+        return;
+      }
+      if (!reachable->test(bitVectorResult->getValueID(other))) {
+        return;
+      }
+    }
+    candidates.push_back(other);
+  };
+
+  /*
+   * Check if @inst belongs to a bucket of an identified object.
+   * If it doesn't, then @inst can conflict with any memory instruction.
+   */
+  auto it = this->memoryBucketOf.find(inst);
+  if (it == this->memoryBucketOf.end()) {
+    for (auto other : this->memoryInstructions) {
+      keepReachable(other);
+    }
+    return candidates;
+  }
+
+  /*
+   * @inst can only conflict with instructions of its bucket and with the ones
+   * of the unknown bucket.
+   */
+  for (auto other : this->memoryBuckets[it->second]) {
+    keepReachable(other);
+  }
+  for (auto other : this->unknownMemoryBucket) {
+    keepReachable(other);
+  }
+
+  return candidates;
+}
+
+} // namespace arcana::noelle
@@ -32,4 +32,28 @@ void PDGGenerator::cleanAndEmbedPDGAsMetadata(PDG *pdg) {
   return;
 }
 
+bool PDGGenerator::isPDGSidecarEnabled(void) const {
+  return !this->sidecarFileName.empty();
+}
+
+void PDGGenerator::cleanAndEmbedPDGAsSidecar(PDG *pdg) {
+  assert(this->isPDGSidecarEnabled());
+
+  /*
+   * Remove any PDG embedded in the IR as the sidecar replaces it.
+   */
+  this->cleanPDGMetadata();
+
+  errs() << "Embed PDG in " << this->sidecarFileName << "\n";
+  if (!PDGSidecar::write(pdg,
+                         this->M,
+                         this->computeConfigurationHash(),
+                         this->sidecarFileName)) {
+    errs() << "PDGGenerator: Error = the PDG has not been stored\n";
+    abort();
+  }
+
+  return;
+}
+
 } // namespace arcana::noelle
@@ -0,0 +1,244 @@
+/*
+ * Copyright 2024  Simone Campanoni
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "arcana/noelle/core/SystemHeaders.hpp"
+#include "arcana/noelle/core/PDGGenerator.hpp"
+#include "arcana/noelle/core/SCCCAG.hpp"
+#include "llvm/Analysis/ValueTracking.h"
+
+namespace arcana::noelle {
+
+void PDGGenerator::computeModRefSummaries(Module &M) {
+  this->resetModRefSummaries();
+
+  /*
+   * Summarize the functions bottom-up on the SCCDAG of the call graph, so the
+   * summaries of the callees are available when the caller is summarized.
+   * Functions that belong to a cycle of the call graph are not summarized,
+   * and calls to them are assumed to access any memory location.
+   */
+  SCCCAG sccCAG(this->getProgramCallGraph());
+  std::unordered_map<SCCCAGNode *, uint64_t> pendingCallees;
+  std::vector<SCCCAGNode *> readyNodes;
+  for (auto node : sccCAG.getNodes()) {
+    auto numberOfCallees = sccCAG.getOutgoingEdges(node).size();
+    pendingCallees[node] = numberOfCallees;
+    if (numberOfCallees == 0) {
+      readyNodes.push_back(node);
+    }
+  }
+  while (!readyNodes.empty()) {
+    auto node = readyNodes.back();
+    readyNodes.pop_back();
+
+    /*
+     * Summarize the function of @node.
+     */
+    if (!node->isAnSCC()) {
+      auto f =
+          static_cast<SCCCAGNode_Function *>(node)->getNode()->getFunction();
+      if (!f->empty()) {
+        this->modRefSummaries[f] = this->computeModRefSummary(*f);
+      }
+    }
+
+    /*
+     * Find the callers that are now ready.
+     */
+    for (auto &[caller, edge] : sccCAG.getIncomingEdges(node)) {
+      if (--pendingCallees[caller] == 0) {
+        readyNodes.push_back(caller);
+      }
+    }
+  }
+  this->modRefSummariesComputed = true;
+
+  if (verbose >= PDGVerbosity::Maximal) {
+    errs() << "PDGGenerator:   Mod/ref summaries of "
+           << this->modRefSummaries.size() << " functions over "
+           << (this->abstractMemoryLocations.size() + 1)
+           << " abstract memory locations\n";
+  }
+
+  return;
+}
+
+PDGGenerator::ModRefSummary PDGGenerator::computeModRefSummary(Function &F) {
+  ModRefSummary summary;
+
+  /*
+   * Map a pointer to the abstract memory location it points to.
+   * Global variables accessed directly have their own location; everything
+   * else is the unknown location.
+   * Stack objects of @F are not visible outside of @F, so they are skipped.
+   */
+  auto addLocation = [this, &F](SparseBitVector<> &locations, Value *pointer) {
+    auto object = getUnderlyingObject(pointer);
+    if (auto alloca = dyn_cast<AllocaInst>(object)) {
+      if (alloca->getFunction() == &F) {
+        return;
+      }
+    }
+    auto global = dyn_cast<GlobalVariable>(object);
+    if (global == nullptr) {
+      locations.set(PDGGenerator::unknownMemoryLocation);
+      return;
+    }
+    auto locationIt = this->abstractMemoryLocations.find(global);
+    if (locationIt == this->abstractMemoryLocations.end()) {
+      auto newLocation = this->abstractMemoryLocations.size() + 1;
+      locationIt =
+          this->abstractMemoryLocations.insert({ global, newLocation }).first;
+    }
+    locations.set(locationIt->second);
+  };
+
+  for (auto &I : instructions(F)) {
+    if (!I.mayReadOrWriteMemory()) {
+      continue;
+    }
+
+    if (auto load = dyn_cast<LoadInst>(&I)) {
+      addLocation(summary.reads, load->getPointerOperand());
+
+    } else if (auto store = dyn_cast<StoreInst>(&I)) {
+      addLocation(summary.writes, store->getPointerOperand());
+
+    } else if (auto call = dyn_cast<CallBase>(&I)) {
+      auto &calleeSummary = this->getModRefSummary(call);
+      summary.reads |= calleeSummary.reads;
+      summary.writes |= calleeSummary.writes;
+
+    } else {
+
+      /*
+       * Atomics, fences, and va_arg are conservatively assumed to access any
+       * memory location.
+       */
+      summary.reads.set(PDGGenerator::unknownMemoryLocation);
+      summary.writes.set(PDGGenerator::unknownMemoryLocation);
+    }
+
+    /*
+     * Nothing else can be learned once @F can access any memory location.
+     */
+    if (summary.reads.test(PDGGenerator::unknownMemoryLocation)
+        && summary.writes.test(PDGGenerator::unknownMemoryLocation)) {
+      return this->unknownModRefSummary;
+    }
+  }
+
+  return summary;
+}
+
+const PDGGenerator::ModRefSummary &PDGGenerator::getModRefSummary(
+    CallBase *call) {
+
+  /*
+   * Check the attributes of the call.
+   */
+  if (call->doesNotAccessMemory()) {
+    return this->noModRefSummary;
+  }
+
+  /*
+   * Check if we have summarized the callee.
+   */
+  auto callee = call->getCalledFunction();
+  if (callee != nullptr) {
+    auto summaryIt = this->modRefSummaries.find(callee);
+    if (summaryIt != this->modRefSummaries.end()) {
+      return summaryIt->second;
+    }
+
+    /*
+     * Check if the callee is a library function that only reads memory.
+     */
+    if (callee->empty() && this->doesTheLibraryFunctionOnlyReadMemory(callee)) {
+      return this->readOnlyModRefSummary;
+    }
+  }
+  if (call->onlyReadsMemory()) {
+    return this->readOnlyModRefSummary;
+  }
+
+  return this->unknownModRefSummary;
+}
+
+bool PDGGenerator::canThereBeADependenceBetweenCalls(CallBase *call,
+                                                     CallBase *otherCall) {
+
+  /*
+   * Without the summaries of the functions, we must assume the two calls can
+   * depend on each other.
+   */
+  if (!this->modRefSummariesComputed) {
+    return true;
+  }
+
+  auto canOverlap = [](const SparseBitVector<> &locations,
+                       const SparseBitVector<> &otherLocations) -> bool {
+    if (locations.empty() || otherLocations.empty()) {
+      return false;
+    }
+    if (locations.test(PDGGenerator::unknownMemoryLocation)
+        || otherLocations.test(PDGGenerator::unknownMemoryLocation)) {
+      return true;
+    }
+    return locations.intersects(otherLocations);
+  };
+
+  /*
+   * There is a dependence only if one of the two calls can write a memory
+   * location that the other one can access.
+   */
+  auto &summary = this->getModRefSummary(call);
+  auto &otherSummary = this->getModRefSummary(otherCall);
+  if (canOverlap(summary.writes, otherSummary.reads)
+      || canOverlap(summary.writes, otherSummary.writes)
+      || canOverlap(summary.reads, otherSummary.writes)) {
+    return true;
+  }
+
+  return false;
+}
+
+void PDGGenerator::resetModRefSummaries(void) {
+  this->modRefSummaries.clear();
+  this->abstractMemoryLocations.clear();
+  this->modRefSummariesComputed = false;
+
+  /*
+   * Summaries of calls that cannot be refined by the callee.
+   * They are kept valid after a reset, so calls are never assumed to access
+   * no memory because of a missing summary.
+   */
+  this->noModRefSummary = ModRefSummary{};
+  this->readOnlyModRefSummary = ModRefSummary{};
+  this->readOnlyModRefSummary.reads.set(PDGGenerator::unknownMemoryLocation);
+  this->unknownModRefSummary = ModRefSummary{};
+  this->unknownModRefSummary.reads.set(PDGGenerator::unknownMemoryLocation);
+  this->unknownModRefSummary.writes.set(PDGGenerator::unknownMemoryLocation);
+
+  return;
+}
+
+} // namespace arcana::noelle
@@ -0,0 +1,214 @@
+/*
+ * Copyright 2024  Simone Campanoni
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include <mutex>
+#include <condition_variable>
+
+#include "arcana/noelle/core/SystemHeaders.hpp"
+#include "arcana/noelle/core/PDGGenerator.hpp"
+#include "llvm/Analysis/PostDominators.h"
+
+namespace arcana::noelle {
+
+void PDGGenerator::constructEdgesInParallel(PDG *pdg, Module &M) {
+  assert(pdg != nullptr);
+  assert(this->numberOfThreads > 1);
+
+  /*
+   * Fetch the functions with a body whose dependences have not been reused.
+   */
+  std::vector<Function *> functions;
+  for (auto &F : M) {
+    if (F.empty()) {
+      continue;
+    }
+    if (this->hasReusedDependences(F)) {
+      continue;
+    }
+    functions.push_back(&F);
+  }
+  auto numberOfFunctions = functions.size();
+  if (verbose >= PDGVerbosity::Maximal) {
+    errs() << "PDGGenerator:   Compute the dependences of " << numberOfFunctions
+           << " functions with " << this->numberOfThreads << " threads\n";
+  }
+
+  /*
+   * Functions are handed out one at a time to the first idle thread.
+   * Threads cannot run too far ahead of the commit to bound the memory needed
+   * by the buffers (reachability results can be large).
+   */
+  std::vector<FunctionDependences> buffers(numberOfFunctions);
+  std::vector<bool> isReady(numberOfFunctions, false);
+  uint64_t nextFunction = 0;
+  uint64_t committedFunctions = 0;
+  uint64_t window = 4 * this->numberOfThreads;
+  std::mutex lock;
+  std::condition_variable cv;
+  auto worker = [&](void) {
+    while (true) {
+
+      /*
+       * Fetch the next function.
+       */
+      std::unique_lock<std::mutex> guard(lock);
+      cv.wait(guard, [&]() -> bool {
+        return (nextFunction >= numberOfFunctions)
+               || (nextFunction < (committedFunctions + window));
+      });
+      if (nextFunction >= numberOfFunctions) {
+        return;
+      }
+      auto functionIndex = nextFunction;
+      nextFunction++;
+      guard.unlock();
+
+      /*
+       * Compute the dependences of the function.
+       */
+      this->computeFunctionDependences(*functions[functionIndex],
+                                       buffers[functionIndex]);
+
+      /*
+       * Notify the committing thread.
+       */
+      guard.lock();
+      isReady[functionIndex] = true;
+      cv.notify_all();
+    }
+  };
+  std::vector<std::thread> threads;
+  for (auto i = 0u; i < this->numberOfThreads; i++) {
+    threads.push_back(std::thread(worker));
+  }
+
+  /*
+   * Commit the dependences to the PDG following the order of the functions in
+   * the module.
+   */
+  for (auto functionIndex = 0u; functionIndex < numberOfFunctions;
+       functionIndex++) {
+
+    /*
+     * Wait for the dependences of the function.
+     */
+    {
+      std::unique_lock<std::mutex> guard(lock);
+      cv.wait(guard, [&]() -> bool { return isReady[functionIndex]; });
+    }
+    auto F = functions[functionIndex];
+    auto &deps = buffers[functionIndex];
+
+    /*
+     * Add the variable dependences.
+     */
+    for (auto &dependence : deps.variableDependences) {
+      pdg->addVariableDataDependenceEdge(dependence.first,
+                                         dependence.second,
+                                         DG_DATA_RAW);
+    }
+
+    /*
+     * Add the memory dependences.
+     * Alias queries are issued here because they rely on the pass manager.
+     */
+    this->constructEdgesFromAliasesForFunction(
+        pdg,
+        *F,
+        deps.reachableMemoryInstructions);
+
+    /*
+     * Add the control dependences.
+     */
+    this->addControlDependences(pdg, deps.controlDependences);
+
+    /*
+     * Free the memory.
+     */
+    delete deps.reachableMemoryInstructions;
+    deps = FunctionDependences{};
+
+    /*
+     * Let the threads move on.
+     */
+    {
+      std::lock_guard<std::mutex> guard(lock);
+      committedFunctions = functionIndex + 1;
+    }
+    cv.notify_all();
+  }
+
+  /*
+   * Wait for the threads.
+   */
+  for (auto &t : threads) {
+    t.join();
+  }
+
+  return;
+}
+
+void PDGGenerator::computeFunctionDependences(Function &F,
+                                              FunctionDependences &deps) {
+
+  /*
+   * This function runs concurrently with other invocations for other
+   * functions. Hence, it only reads the IR and it must not use state owned by
+   * the pass manager.
+   */
+
+  /*
+   * Collect the dependences due to variables.
+   */
+  auto collectUses = [&deps](Value *v) {
+    for (auto &U : v->uses()) {
+      auto user = U.getUser();
+      if (isa<Instruction>(user) || isa<Argument>(user)) {
+        deps.variableDependences.push_back(std::make_pair(v, user));
+      }
+    }
+  };
+  for (auto &arg : F.args()) {
+    collectUses(&arg);
+  }
+  for (auto &I : instructions(F)) {
+    collectUses(&I);
+  }
+
+  /*
+   * Compute the control dependences.
+   * The post-dominator tree is computed locally because the one of the pass
+   * manager cannot be fetched concurrently.
+   */
+  PostDominatorTree postDomTree(F);
+  deps.controlDependences =
+      PDGGenerator::computeControlDependences(F, postDomTree);
+
+  /*
+   * Run the reachable analysis needed by the memory dependences.
+   */
+  deps.reachableMemoryInstructions =
+      this->computeReachableMemoryInstructions(F);
+
+  return;
+}
+
+} // namespace arcana::noelle
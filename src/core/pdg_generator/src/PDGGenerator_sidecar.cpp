@@ -0,0 +1,209 @@
+/*
+ * Copyright 2024  Simone Campanoni
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "llvm/Support/xxhash.h"
+#include "arcana/noelle/core/SystemHeaders.hpp"
+#include "arcana/noelle/core/PDGGenerator.hpp"
+
+namespace arcana::noelle {
+
+void PDGGenerator::addDependencesFromSidecar(PDG *pdg,
+                                             Module &M,
+                                             PDGSidecar &sidecar) {
+  assert(pdg != nullptr);
+
+  /*
+   * Check the dependences of a function depend only on its code and on the
+   * code of its callees.
+   * SVF answers the queries about a function using the points-to information
+   * of the whole program, so a change anywhere can add dependences to
+   * functions that did not change.
+   */
+#ifdef NOELLE_ENABLE_SVF
+  if (!this->disableSVF) {
+    if (verbose >= PDGVerbosity::Minimal) {
+      errs() << "PDGGenerator:   Do not reuse dependences because SVF is "
+                "enabled\n";
+    }
+    return;
+  }
+#endif
+
+  /*
+   * Check the sidecar file can be used.
+   * Dependences computed with different options or analyses (e.g., without
+   * AllocAA) differ from those this generator computes.
+   * Changes to the global values can affect the dependences of any function.
+   * So can changes to how any function accesses the global variables, because
+   * module-level alias analyses (e.g., GlobalsAA) rely on them.
+   */
+  if (!sidecar.hasTheSameConfiguration(this->computeConfigurationHash())) {
+    return;
+  }
+  if (!sidecar.hasTheSameGlobals(M)) {
+    return;
+  }
+  if (!sidecar.hasTheSameMemorySummary(M)) {
+    return;
+  }
+
+  /*
+   * Identify the functions that changed since the sidecar file was written.
+   */
+  std::unordered_set<Function *> toRecompute;
+  std::vector<Function *> workingList;
+  uint64_t numberOfFunctions = 0;
+  for (auto &F : M) {
+    if (F.empty()) {
+      continue;
+    }
+    numberOfFunctions++;
+    if (!sidecar.hasUpToDateDependences(F)) {
+      toRecompute.insert(&F);
+      workingList.push_back(&F);
+    }
+  }
+
+  /*
+   * The memory dependences of a call instruction depend on the mod/ref
+   * behavior of its callees, which depends on their code.
+   * Hence, the callers of a function that changed need to be recomputed as
+   * well (transitively).
+   * Functions with indirect calls might invoke any function, so they are
+   * recomputed if any function changed.
+   */
+  if (!toRecompute.empty()) {
+    auto &callGraph = this->getCallGraph();
+    std::unordered_map<Function *, std::vector<Function *>> callers;
+    for (auto &F : M) {
+      if (F.empty()) {
+        continue;
+      }
+      for (auto &callRecord : *callGraph[&F]) {
+        auto callee = callRecord.second->getFunction();
+        if (callee == nullptr) {
+          if (toRecompute.insert(&F).second) {
+            workingList.push_back(&F);
+          }
+          continue;
+        }
+        callers[callee].push_back(&F);
+      }
+    }
+    while (!workingList.empty()) {
+      auto F = workingList.back();
+      workingList.pop_back();
+      for (auto caller : callers[F]) {
+        if (toRecompute.insert(caller).second) {
+          workingList.push_back(caller);
+        }
+      }
+    }
+  }
+
+  /*
+   * Reuse the dependences of the other functions.
+   */
+  for (auto &F : M) {
+    if (F.empty()) {
+      continue;
+    }
+    if (toRecompute.find(&F) != toRecompute.end()) {
+      continue;
+    }
+    if (sidecar.addDependences(pdg, F)) {
+      this->functionsWithReusedDependences.insert(&F);
+    }
+  }
+  if (verbose >= PDGVerbosity::Minimal) {
+    errs() << "PDGGenerator:   Reuse the dependences of "
+           << this->functionsWithReusedDependences.size() << " out of "
+           << numberOfFunctions << " functions\n";
+  }
+
+  return;
+}
+
+uint64_t PDGGenerator::computeConfigurationHash(void) const {
+
+  /*
+   * Hash the options that change the dependences.
+   * SVF is used only if NOELLE has been built with it.
+   */
+  auto useSVF = false;
+  auto useSVFCallGraph = false;
+#ifdef NOELLE_ENABLE_SVF
+  useSVF = !this->disableSVF;
+  useSVFCallGraph = !this->disableSVFCallGraph;
+#endif
+  std::vector<uint64_t> words{ useSVF,
+                               useSVFCallGraph,
+                               this->disableAllocAA,
+                               this->disableRA };
+
+  /*
+   * Hash the dependence analyses in the order they are invoked.
+   */
+  auto ddAnalysisProfiles = this->ddAnalyses.getProfiles();
+  words.push_back(ddAnalysisProfiles.size());
+  for (auto &profile : ddAnalysisProfiles) {
+    words.push_back(xxHash64(profile.name));
+  }
+
+  /*
+   * Hash the call graph analyses.
+   * They are kept in a set of pointers, so their names are sorted to make the
+   * hash independent of where they have been allocated.
+   */
+  std::vector<std::string> cgAnalysisNames;
+  for (auto cgAnalysis : this->cgAnalyses) {
+    cgAnalysisNames.push_back(cgAnalysis->getName());
+  }
+  std::sort(cgAnalysisNames.begin(), cgAnalysisNames.end());
+  words.push_back(cgAnalysisNames.size());
+  for (auto &name : cgAnalysisNames) {
+    words.push_back(xxHash64(name));
+  }
+
+  auto bytes = reinterpret_cast<const uint8_t *>(words.data());
+  return xxHash64(ArrayRef<uint8_t>(bytes, words.size() * sizeof(uint64_t)));
+}
+
+bool PDGGenerator::hasReusedDependences(Function &F) const {
+  return this->functionsWithReusedDependences.find(&F)
+         != this->functionsWithReusedDependences.end();
+}
+
+bool PDGGenerator::hasReusedDependences(Value *v) const {
+  if (this->functionsWithReusedDependences.empty()) {
+    return false;
+  }
+  if (auto arg = dyn_cast<Argument>(v)) {
+    return this->hasReusedDependences(*arg->getParent());
+  }
+  if (auto inst = dyn_cast<Instruction>(v)) {
+    return this->hasReusedDependences(*inst->getFunction());
+  }
+
+  return false;
+}
+
+} // namespace arcana::noelle
@@ -0,0 +1,560 @@
+/*
+ * Copyright 2024  Simone Campanoni
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "llvm/Support/LEB128.h"
+#include "arcana/noelle/core/IRHash.hpp"
+#include "arcana/noelle/core/PDGSidecar.hpp"
+
+namespace arcana::noelle {
+
+const char PDGSidecar::magic[8] = { 'N', 'O', 'E', 'L', 'L', 'E', 'P', 'G' };
+
+const uint32_t PDGSidecar::version = 5;
+
+PDGSidecar::PDGSidecar(const std::string &fileName)
+  : fileName{ fileName },
+    file{ fileName,
+          PDGSidecar::magic,
+          PDGSidecar::version,
+          PDGSidecar::NUMBER_OF_HEADER_WORDS } {
+  return;
+}
+
+bool PDGSidecar::isValid(void) const {
+  return this->file.isValid();
+}
+
+bool PDGSidecar::isUpToDate(Module &M) const {
+  if (!this->file.isValid()) {
+    return false;
+  }
+
+  return this->file.getHeaderWord(MODULE_HASH)
+         == PDGSidecar::computeModuleHash(M);
+}
+
+bool PDGSidecar::hasTheSameConfiguration(uint64_t configurationHash) const {
+  if (!this->file.isValid()) {
+    return false;
+  }
+
+  return this->file.getHeaderWord(CONFIGURATION_HASH) == configurationHash;
+}
+
+bool PDGSidecar::hasTheSameGlobals(Module &M) const {
+  if (!this->file.isValid()) {
+    return false;
+  }
+
+  return this->file.getHeaderWord(GLOBALS_HASH)
+         == IRHash::computeGlobalsHash(M);
+}
+
+bool PDGSidecar::hasTheSameMemorySummary(Module &M) const {
+  if (!this->file.isValid()) {
+    return false;
+  }
+
+  return this->file.getHeaderWord(MEMORY_SUMMARY_HASH)
+         == PDGSidecar::computeMemorySummaryHash(M);
+}
+
+bool PDGSidecar::hasUpToDateDependences(Function &F) const {
+  auto section = this->file.getSection(F.getName());
+  if (section == nullptr) {
+    return false;
+  }
+
+  return section->hash == IRHash::computeFunctionHash(F);
+}
+
+bool PDGSidecar::addDependences(PDG *pdg, Function &F) const {
+  assert(pdg != nullptr);
+  assert(this->file.isValid());
+
+  /*
+   * Fetch the section of @F.
+   */
+  auto section = this->file.getSection(F.getName());
+  if (section == nullptr) {
+    return false;
+  }
+  auto p = section->begin;
+  auto end = section->end;
+
+  /*
+   * Decode the next number.
+   * Truncated sections are reported through @error.
+   */
+  const char *error = nullptr;
+  auto next = [&p, end, &error]() -> uint64_t {
+    unsigned n = 0;
+    auto value = decodeULEB128(p, &n, end, &error);
+    p += n;
+    return value;
+  };
+  auto nextByte = [&p, end, &error]() -> uint8_t {
+    if (p >= end) {
+      error = "truncated section";
+      return 0;
+    }
+    return *(p++);
+  };
+
+  /*
+   * Check the nodes.
+   */
+  auto nodes = PDGSidecar::getNodes(F);
+  auto numberOfNodes = next();
+  auto numberOfEdges = next();
+  if ((error != nullptr) || (numberOfNodes != nodes.size())) {
+    return false;
+  }
+
+  /*
+   * Decode the edges.
+   */
+  auto getDataDependenceType = [](uint8_t attributes) {
+    return static_cast<DataDependenceType>(
+        (attributes & DATA_DEPENDENCE_MASK) >> DATA_DEPENDENCE_SHIFT);
+  };
+  auto addEdge = [pdg, &nodes, &getDataDependenceType](
+                     uint64_t src,
+                     uint64_t dst,
+                     uint8_t attributes) -> DGEdge<Value, Value> * {
+    auto from = nodes[src];
+    auto to = nodes[dst];
+    auto dataDepType = getDataDependenceType(attributes);
+    DGEdge<Value, Value> *edge = nullptr;
+    switch (attributes & KIND_MASK) {
+      case KIND_VARIABLE:
+        edge = pdg->addVariableDataDependenceEdge(from, to, dataDepType);
+        break;
+      case KIND_MAY_MEMORY:
+        edge =
+            pdg->addMemoryDataDependenceEdge(from, to, dataDepType, false);
+        break;
+      case KIND_MUST_MEMORY:
+        edge = pdg->addMemoryDataDependenceEdge(from, to, dataDepType, true);
+        break;
+      default:
+        edge = pdg->addControlDependenceEdge(from, to);
+        break;
+    }
+    edge->setLoopCarried((attributes & LOOP_CARRIED) != 0);
+    return edge;
+  };
+
+  /*
+   * Sub-edges are not part of the graph (as for the PDG embedded in the IR).
+   */
+  auto newSubEdge = [pdg, &nodes, &getDataDependenceType](
+                        uint64_t src,
+                        uint64_t dst,
+                        uint8_t attributes) -> DGEdge<Value, Value> * {
+    auto from = pdg->fetchNode(nodes[src]);
+    auto to = pdg->fetchNode(nodes[dst]);
+    auto dataDepType = getDataDependenceType(attributes);
+    DGEdge<Value, Value> *edge = nullptr;
+    switch (attributes & KIND_MASK) {
+      case KIND_VARIABLE:
+        edge = new VariableDependence<Value, Value>(from, to, dataDepType);
+        break;
+      case KIND_MAY_MEMORY:
+        edge = new MayMemoryDependence<Value, Value>(from, to, dataDepType);
+        break;
+      case KIND_MUST_MEMORY:
+        edge = new MustMemoryDependence<Value, Value>(from, to, dataDepType);
+        break;
+      default:
+        edge = new ControlDependence<Value, Value>(from, to);
+        break;
+    }
+    edge->setLoopCarried((attributes & LOOP_CARRIED) != 0);
+    return edge;
+  };
+  std::vector<DGEdge<Value, Value> *> addedEdges;
+  addedEdges.reserve(numberOfEdges);
+  uint64_t src = 0;
+  uint64_t dst = 0;
+  for (auto i = 0u; (i < numberOfEdges) && (error == nullptr); i++) {
+    auto srcDelta = next();
+    auto dstValue = next();
+    auto attributes = nextByte();
+    dst = (srcDelta == 0) ? (dst + dstValue) : dstValue;
+    src += srcDelta;
+    if ((error != nullptr) || (src >= numberOfNodes)
+        || (dst >= numberOfNodes)) {
+      error = "node ID out of range";
+      break;
+    }
+    auto edge = addEdge(src, dst, attributes);
+    addedEdges.push_back(edge);
+
+    /*
+     * Decode the sub-edges.
+     */
+    if ((attributes & HAS_SUB_EDGES) == 0) {
+      continue;
+    }
+    auto numberOfSubEdges = next();
+    for (auto j = 0u; (j < numberOfSubEdges) && (error == nullptr); j++) {
+      auto subSrc = next();
+      auto subDst = next();
+      auto subAttributes = nextByte();
+      if ((error != nullptr) || (subSrc >= numberOfNodes)
+          || (subDst >= numberOfNodes)) {
+        error = "node ID out of range";
+        break;
+      }
+      edge->addSubEdge(newSubEdge(subSrc, subDst, subAttributes));
+    }
+  }
+  if (error != nullptr) {
+    errs() << "PDGSidecar: the section of " << F.getName() << " in "
+           << this->fileName << " is corrupted (" << error << ")\n";
+    for (auto edge : addedEdges) {
+      pdg->removeEdge(edge);
+    }
+    return false;
+  }
+
+  return true;
+}
+
+std::vector<Value *> PDGSidecar::getNodes(Function &F) {
+  std::vector<Value *> nodes;
+  for (auto &arg : F.args()) {
+    nodes.push_back(&arg);
+  }
+  for (auto &inst : instructions(F)) {
+    nodes.push_back(&inst);
+  }
+
+  return nodes;
+}
+
+/*
+ * How a global variable is used.
+ */
+enum GlobalVariableUse : uint64_t {
+  GLOBAL_LOADED = 1,
+  GLOBAL_STORED = 2,
+  GLOBAL_STORED_POINTER_FROM_CALL = 3,
+  GLOBAL_STORED_POINTER = 4,
+  GLOBAL_ESCAPED = 5
+};
+
+static void collectGlobalVariables(Value *v,
+                                   SmallPtrSetImpl<GlobalVariable *> &globals,
+                                   SmallPtrSetImpl<Constant *> &visited) {
+  if (auto g = dyn_cast<GlobalVariable>(v)) {
+    globals.insert(g);
+    return;
+  }
+  auto c = dyn_cast<Constant>(v);
+  if ((c == nullptr) || isa<GlobalValue>(c) || !visited.insert(c).second) {
+    return;
+  }
+  for (auto &operand : c->operands()) {
+    collectGlobalVariables(operand.get(), globals, visited);
+  }
+
+  return;
+}
+
+static GlobalVariableUse getGlobalVariableUse(Instruction &inst,
+                                              unsigned operandID) {
+  if (isa<LoadInst>(&inst)) {
+    return GLOBAL_LOADED;
+  }
+  if (auto storeInst = dyn_cast<StoreInst>(&inst)) {
+    if (operandID != storeInst->getPointerOperandIndex()) {
+      return GLOBAL_ESCAPED;
+    }
+    auto storedValue = storeInst->getValueOperand();
+    if (!storedValue->getType()->isPointerTy()
+        || isa<ConstantPointerNull>(storedValue)) {
+      return GLOBAL_STORED;
+    }
+    if (isa<CallBase>(storedValue)) {
+      return GLOBAL_STORED_POINTER_FROM_CALL;
+    }
+    return GLOBAL_STORED_POINTER;
+  }
+
+  return GLOBAL_ESCAPED;
+}
+
+uint64_t PDGSidecar::computeMemorySummaryHash(Module &M) {
+  std::vector<uint64_t> words;
+  std::set<std::pair<uint64_t, uint64_t>> uses;
+  SmallPtrSet<GlobalVariable *, 4> globals;
+  SmallPtrSet<Constant *, 16> visited;
+  auto addUses = [&uses, &globals](GlobalVariableUse use) {
+    for (auto g : globals) {
+      uses.insert(std::make_pair(IRHash::hashString(g->getName()), use));
+    }
+    globals.clear();
+  };
+  auto flushUses = [&words, &uses](StringRef owner) {
+    if (uses.empty()) {
+      return;
+    }
+    words.push_back(IRHash::hashString(owner));
+    for (auto &use : uses) {
+      words.push_back(use.first);
+      words.push_back(use.second);
+    }
+    uses.clear();
+  };
+
+  /*
+   * Summarize the global variables whose address is stored in the
+   * initializers of the others.
+   */
+  for (auto &g : M.globals()) {
+    if (!g.hasInitializer()) {
+      continue;
+    }
+    visited.clear();
+    collectGlobalVariables(g.getInitializer(), globals, visited);
+    addUses(GLOBAL_ESCAPED);
+    flushUses(g.getName());
+  }
+
+  /*
+   * Summarize the global variables used by the functions.
+   */
+  for (auto &F : M) {
+    if (F.isDeclaration()) {
+      continue;
+    }
+    for (auto &inst : instructions(F)) {
+      for (auto &operand : inst.operands()) {
+        if (!isa<Constant>(operand.get())) {
+          continue;
+        }
+        visited.clear();
+        collectGlobalVariables(operand.get(), globals, visited);
+        if (globals.empty()) {
+          continue;
+        }
+        addUses(getGlobalVariableUse(inst, operand.getOperandNo()));
+      }
+    }
+    flushUses(F.getName());
+  }
+
+  return IRHash::hashWords(words);
+}
+
+uint64_t PDGSidecar::computeModuleHash(Module &M) {
+  std::vector<uint64_t> words;
+  words.push_back(IRHash::computeGlobalsHash(M));
+  for (auto &F : M) {
+    if (F.isDeclaration()) {
+      continue;
+    }
+    words.push_back(IRHash::computeFunctionHash(F));
+  }
+
+  return IRHash::hashWords(words);
+}
+
+uint8_t PDGSidecar::getAttributes(DGEdge<Value, Value> *edge) {
+  uint8_t attributes = 0;
+
+  /*
+   * Encode the kind of the dependence.
+   */
+  if (isa<ControlDependence<Value, Value>>(edge)) {
+    attributes |= KIND_CONTROL;
+  } else if (isa<MustMemoryDependence<Value, Value>>(edge)) {
+    attributes |= KIND_MUST_MEMORY;
+  } else if (isa<MayMemoryDependence<Value, Value>>(edge)) {
+    attributes |= KIND_MAY_MEMORY;
+  } else {
+    assert((isa<VariableDependence<Value, Value>>(edge)));
+    attributes |= KIND_VARIABLE;
+  }
+
+  /*
+   * Encode the type of the data dependence.
+   */
+  if (auto dataDep = dyn_cast<DataDependence<Value, Value>>(edge)) {
+    attributes |= (dataDep->getDataDependenceType() << DATA_DEPENDENCE_SHIFT);
+  }
+
+  /*
+   * Encode the flags.
+   */
+  if (edge->isLoopCarriedDependence()) {
+    attributes |= LOOP_CARRIED;
+  }
+  if (edge->getNumberOfSubEdges() > 0) {
+    attributes |= HAS_SUB_EDGES;
+  }
+
+  return attributes;
+}
+
+void PDGSidecar::writeFunction(PDG *pdg, Function &F, raw_ostream &out) {
+
+  /*
+   * Assign the IDs to the nodes.
+   */
+  auto nodes = PDGSidecar::getNodes(F);
+  DenseMap<Value *, uint32_t> nodeIDs;
+  for (auto i = 0u; i < nodes.size(); i++) {
+    nodeIDs[nodes[i]] = i;
+  }
+
+  /*
+   * Collect the edges and sort them by source and destination.
+   */
+  struct Edge {
+    uint32_t src;
+    uint32_t dst;
+    uint8_t attributes;
+    DGEdge<Value, Value> *edge;
+  };
+  std::vector<Edge> edges;
+  for (auto i = 0u; i < nodes.size(); i++) {
+    if (!pdg->isInGraph(nodes[i])) {
+      continue;
+    }
+    for (auto edge : pdg->fetchNode(nodes[i])->getOutgoingEdges()) {
+      auto dstIt = nodeIDs.find(edge->getDst());
+      if (dstIt == nodeIDs.end()) {
+        continue;
+      }
+      edges.push_back(
+          { i, dstIt->second, PDGSidecar::getAttributes(edge), edge });
+    }
+  }
+  std::sort(edges.begin(), edges.end(), [](const Edge &a, const Edge &b) {
+    return std::tie(a.src, a.dst, a.attributes)
+           < std::tie(b.src, b.dst, b.attributes);
+  });
+
+  /*
+   * Encode the edges.
+   */
+  encodeULEB128(nodes.size(), out);
+  encodeULEB128(edges.size(), out);
+  uint32_t previousSrc = 0;
+  uint32_t previousDst = 0;
+  for (auto &e : edges) {
+    encodeULEB128(e.src - previousSrc, out);
+    if (e.src == previousSrc) {
+      encodeULEB128(e.dst - previousDst, out);
+    } else {
+      encodeULEB128(e.dst, out);
+    }
+    out << static_cast<char>(e.attributes);
+    previousSrc = e.src;
+    previousDst = e.dst;
+
+    /*
+     * Encode the sub-edges.
+     */
+    if ((e.attributes & HAS_SUB_EDGES) == 0) {
+      continue;
+    }
+    auto subEdges = e.edge->getSubEdges();
+    encodeULEB128(subEdges.size(), out);
+    for (auto subEdge : subEdges) {
+      encodeULEB128(nodeIDs.lookup(subEdge->getSrc()), out);
+      encodeULEB128(nodeIDs.lookup(subEdge->getDst()), out);
+      out << static_cast<char>(PDGSidecar::getAttributes(subEdge)
+                               & ~HAS_SUB_EDGES);
+    }
+  }
+
+  return;
+}
+
+bool PDGSidecar::write(PDG *pdg,
+                       Module &M,
+                       uint64_t configurationHash,
+                       const std::string &fileName) {
+  assert(pdg != nullptr);
+
+  /*
+   * Encode the sections of the functions.
+   */
+  FunctionSectionsFileWriter writer(PDGSidecar::magic, PDGSidecar::version);
+  auto globalsHash = IRHash::computeGlobalsHash(M);
+  std::vector<uint64_t> moduleWords{ globalsHash };
+  for (auto &F : M) {
+    if (F.isDeclaration()) {
+      continue;
+    }
+    auto hash = IRHash::computeFunctionHash(F);
+    writer.addSection(F.getName(), hash, [pdg, &F](raw_ostream &out) {
+      PDGSidecar::writeFunction(pdg, F, out);
+    });
+    moduleWords.push_back(hash);
+  }
+
+  /*
+   * Write the file.
+   */
+  std::vector<uint64_t> headerWords(NUMBER_OF_HEADER_WORDS);
+  headerWords[CONFIGURATION_HASH] = configurationHash;
+  headerWords[MODULE_HASH] = IRHash::hashWords(moduleWords);
+  headerWords[GLOBALS_HASH] = globalsHash;
+  headerWords[MEMORY_SUMMARY_HASH] = PDGSidecar::computeMemorySummaryHash(M);
+
+  return writer.write(fileName, headerWords, "PDGSidecar");
+}
+
+PDG *PDGSidecar::loadPDG(Module &M, uint64_t configurationHash) const {
+
+  /*
+   * Check the file stores the PDG of @M computed with the same configuration.
+   */
+  if (!this->hasTheSameConfiguration(configurationHash)) {
+    return nullptr;
+  }
+  if (!this->isUpToDate(M)) {
+    return nullptr;
+  }
+
+  /*
+   * Load the dependences of all functions.
+   */
+  auto pdg = new PDG(M);
+  for (auto &F : M) {
+    if (F.isDeclaration()) {
+      continue;
+    }
+    if (!this->addDependences(pdg, F)) {
+      delete pdg;
+      return nullptr;
+    }
+  }
+
+  return pdg;
+}
+
+} // namespace arcana::noelle
@@ -27,8 +27,18 @@
 
 namespace arcana::noelle {
 
+class SCCDAG;
+
 /*
  * Strongly Connected Component
+ *
+ * An SCC is a view of the dependence graph it has been computed from: its
+ * nodes and its dependences are the ones of that graph, which therefore must
+ * outlive the SCC.
+ * Internal nodes are the ones that compose the SCC. External nodes are the
+ * ones connected to them by at least one dependence.
+ * Notice that the dependences of an external node are the ones it has in the
+ * dependence graph, which can go outside the SCC (see isIncluded).
  */
 class SCC : public DG<Value> {
 public:
@@ -73,6 +83,12 @@ public:
   bool iterateOverAllInstructions(
       std::function<bool(Instruction *)> funcToInvoke);
 
+  /*
+   * Check if @dependence is a dependence of the SCC.
+   * This is the case if at least one of its ends is internal to the SCC.
+   */
+  bool isIncluded(DGEdge<Value, Value> *dependence) const;
+
   /*
    * Check if the SCC has cycles in it.
    */
@@ -101,8 +117,16 @@ public:
   ~SCC();
 
 private:
-  void copyNodesAndEdges(std::set<DGNode<Value> *> internalNodes,
-                         std::set<DGNode<Value> *> externalNodes);
+  friend class SCCDAG;
+
+  /*
+   * Dense index of the SCC within the SCCDAG that includes it.
+   */
+  static constexpr uint32_t InvalidIndex = UINT32_MAX;
+  uint32_t index;
+
+  void addNodesAndEdges(std::set<DGNode<Value> *> const &internalNodes,
+                        std::set<DGNode<Value> *> const &externalNodes);
 };
 
 template <>
@@ -93,6 +93,18 @@ public:
    */
   void mergeSCCs(std::set<DGNode<SCC> *> &sccSet);
 
+  /*
+   * Remove the dependences @edges from @dependenceGraph, which must be the
+   * graph "this" SCCDAG has been computed from, and update the SCCDAG.
+   *
+   * Only the SCCs that contain an end of a removed dependence are recomputed
+   * (and possibly split). These SCCs are replaced by new ones. The reachability
+   * among SCCs is recomputed only for the SCCs that could reach them.
+   */
+  void removeDependences(
+      PDG *dependenceGraph,
+      std::unordered_set<DGEdge<Value, Value> *> const &edges);
+
   /*
    * Return the SCC that contains @val
    */
@@ -112,6 +124,7 @@ public:
 
   /*
    * Get the index of a node of the SCCDAG.
+   * Indexes are dense and they are stored in the SCCs, so this is O(1).
    */
   uint32_t getSCCIndex(const SCC *scc) const;
 
@@ -137,13 +150,37 @@ private:
    */
   bool orderedDirty;
 
-  // SCC nodes to Ids map.
-  std::unordered_map<const SCC *, uint32_t> sccIndexes;
+  /*
+   * Indexes of the bit matrix that are not used by any node of the SCCDAG.
+   */
+  std::vector<uint32_t> freeSCCIndexes;
 
   /*
    * Compute transitive dependences between nodes of the SCCDAG.
    */
   void computeReachabilityAmongSCCs(void);
+
+  /*
+   * Recompute the transitive dependences of @sccNodes, which must include all
+   * nodes that can reach any of them.
+   */
+  void computeReachabilityOf(std::unordered_set<DGNode<SCC> *> &sccNodes);
+
+  /*
+   * Add the dependences between SCCs that have at least one end in
+   * @newSCCNodes. The other end of these dependences is either in @newSCCNodes
+   * or in @neighbors.
+   */
+  void markEdgesAndSubEdgesOf(
+      std::unordered_set<DGNode<SCC> *> const &newSCCNodes,
+      std::unordered_set<DGNode<SCC> *> const &neighbors);
+
+  /*
+   * Compute the SCCs of the sub-graph that includes only the nodes @nodes and
+   * the dependences among them.
+   */
+  static std::vector<std::set<DGNode<Value> *>> computeSCCsOf(
+      std::set<DGNode<Value> *> const &nodes);
 };
 
 } // namespace arcana::noelle
@@ -24,7 +24,7 @@
 
 namespace arcana::noelle {
 
-SCC::SCC(std::set<DGNode<Value> *> internalNodes) {
+SCC::SCC(std::set<DGNode<Value> *> internalNodes) : index{ InvalidIndex } {
 
   /*
    * Collect all internal values
@@ -36,8 +36,6 @@ SCC::SCC(std::set<DGNode<Value> *> internalNodes) {
 
   /*
    * Determine nodes that are not internal
-   * Compare by value and NOT node to avoid duplicate classification
-   *  if the set of nodes come from 2+ graph contexts
    */
   std::set<DGNode<Value> *> externalNodes;
   for (auto node : internalNodes) {
@@ -53,60 +51,58 @@ SCC::SCC(std::set<DGNode<Value> *> internalNodes) {
     }
   }
 
-  copyNodesAndEdges(internalNodes, externalNodes);
+  this->addNodesAndEdges(internalNodes, externalNodes);
 }
 
 SCC::SCC(std::set<DGNode<Value> *> internalNodes,
-         std::set<DGNode<Value> *> externalNodes) {
-  copyNodesAndEdges(internalNodes, externalNodes);
+         std::set<DGNode<Value> *> externalNodes)
+  : index{ InvalidIndex } {
+  this->addNodesAndEdges(internalNodes, externalNodes);
 }
 
-void SCC::copyNodesAndEdges(std::set<DGNode<Value> *> internalNodes,
-                            std::set<DGNode<Value> *> externalNodes) {
+void SCC::addNodesAndEdges(std::set<DGNode<Value> *> const &internalNodes,
+                           std::set<DGNode<Value> *> const &externalNodes) {
 
   /*
    * Add all nodes by classification. Arbitrarily choose entry node from all
-   * nodes
+   * nodes.
+   * Nodes are not copied: the SCC refers to the nodes of the dependence graph.
    */
   for (auto node : internalNodes) {
-    addNode(node->getT(), /*internal=*/true);
+    this->internalNodeMap[node->getT()] = node;
+    this->allNodes.insert(node);
   }
   for (auto node : externalNodes) {
-    addNode(node->getT(), /*internal=*/false);
+    this->externalNodeMap[node->getT()] = node;
+    this->allNodes.insert(node);
   }
-  entryNode = (*allNodes.begin());
+  this->entryNode = (*this->allNodes.begin());
 
   /*
-   * Add internal edges on this SCC's instructions
-   * Note: to avoid edge duplication, ignore incoming edges from internal nodes
-   * (they were considered in outgoing edges)
+   * Add the dependences that connect an internal node to a node of the SCC.
+   * Like nodes, dependences are not copied.
    */
   for (auto node : internalNodes) {
     for (auto edge : node->getOutgoingEdges()) {
-      auto incomingT = edge->getDst();
-      if (isExternal(incomingT))
+      if (!this->isInGraph(edge->getDst())) {
         continue;
-      copyAddEdge(*edge);
-    }
-  }
-
-  /*
-   * Add external edges on this SCC's instructions
-   */
-  for (auto node : internalNodes) {
-    for (auto edge : node->getOutgoingEdges()) {
-      auto incomingT = edge->getDstNode()->getT();
-      if (isInternal(incomingT))
-        continue;
-      copyAddEdge(*edge);
+      }
+      this->allEdges.insert(edge);
     }
     for (auto edge : node->getIncomingEdges()) {
-      auto outgoingT = edge->getSrcNode()->getT();
-      if (isInternal(outgoingT))
+      if (!this->isInGraph(edge->getSrc())) {
         continue;
-      copyAddEdge(*edge);
+      }
+      this->allEdges.insert(edge);
     }
   }
+
+  return;
+}
+
+bool SCC::isIncluded(DGEdge<Value, Value> *dependence) const {
+  return this->isInternal(dependence->getSrc())
+         || this->isInternal(dependence->getDst());
 }
 
 int64_t SCC::numberOfInstructions(void) const {
@@ -197,6 +193,8 @@ bool SCC::hasCycle(bool ignoreControlDep) {
       auto node = nodesToVisit.front();
       nodesToVisit.pop();
       for (auto edge : node->getOutgoingEdges()) {
+        if (!this->isIncluded(edge))
+          continue;
         if (ignoreControlDep && isa<ControlDependence<Value, Value>>(edge))
           continue;
 
@@ -295,6 +293,14 @@ bool SCC::iterateOverAllValues(std::function<bool(Value *)> funcToInvoke) {
 }
 
 SCC::~SCC() {
+
+  /*
+   * Nodes and dependences belong to the dependence graph the SCC has been
+   * computed from.
+   * Hence, forget them before DG<Value> releases what it owns.
+   */
+  this->clear();
+
   return;
 }
 
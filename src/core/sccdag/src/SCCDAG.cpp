@@ -141,43 +141,48 @@ void SCCDAG::markEdgesAndSubEdges(void) {
     /*
      * Check dependences that go outside the current SCC.
      */
-    for (auto externalNodePair : outgoingSCC->externalNodePairs()) {
-      auto incomingNode = externalNodePair.second;
-      if (incomingNode->inDegree() == 0)
-        continue;
-
-      auto incomingSCCNode = this->valueToSCCNode[externalNodePair.first];
-      auto incomingSCC = incomingSCCNode->getT();
-
-      /*
-       * Find or create unique edge between the two connected SCC
-       */
-      std::unordered_set<DGEdge<SCC, SCC> *> edgeSet;
-      for (auto edge : outgoingSCCNode->getOutgoingEdges()) {
-        if (edge->getDstNode() != incomingSCCNode)
+    std::unordered_map<DGNode<SCC> *, DGEdge<SCC, SCC> *> sccEdges;
+    for (auto internalNodePair : outgoingSCC->internalNodePairs()) {
+      auto outgoingNode = internalNodePair.second;
+      for (auto edge : outgoingNode->getOutgoingEdges()) {
+        auto incomingValue = edge->getDst();
+        if (outgoingSCC->isInternal(incomingValue))
           continue;
-        edgeSet.insert(edge);
-      }
-      for (auto edge : outgoingSCCNode->getIncomingEdges()) {
-        if (edge->getSrcNode() != incomingSCCNode)
-          continue;
-        edgeSet.insert(edge);
-      }
-      auto sccEdge =
-          edgeSet.empty()
-              ? this->addUndefinedDependenceEdge(outgoingSCC, incomingSCC)
-              : (*edgeSet.begin());
 
-      /*
-       * Clear out subedges if not already done once; add all currently existing
-       * subedges
-       */
-      if (clearedEdges.find(sccEdge) == clearedEdges.end()) {
-        sccEdge->removeSubEdges();
-        clearedEdges.insert(sccEdge);
-      }
-      for (auto edge : incomingNode->getIncomingEdges())
+        /*
+         * Find or create unique edge between the two connected SCC
+         */
+        auto incomingSCCNode = this->valueToSCCNode[incomingValue];
+        auto &sccEdge = sccEdges[incomingSCCNode];
+        if (sccEdge == nullptr) {
+          auto incomingSCC = incomingSCCNode->getT();
+          std::unordered_set<DGEdge<SCC, SCC> *> edgeSet;
+          for (auto otherEdge : outgoingSCCNode->getOutgoingEdges()) {
+            if (otherEdge->getDstNode() != incomingSCCNode)
+              continue;
+            edgeSet.insert(otherEdge);
+          }
+          for (auto otherEdge : outgoingSCCNode->getIncomingEdges()) {
+            if (otherEdge->getSrcNode() != incomingSCCNode)
+              continue;
+            edgeSet.insert(otherEdge);
+          }
+          sccEdge =
+              edgeSet.empty()
+                  ? this->addUndefinedDependenceEdge(outgoingSCC, incomingSCC)
+                  : (*edgeSet.begin());
+        }
+
+        /*
+         * Clear out subedges if not already done once; add all currently
+         * existing subedges
+         */
+        if (clearedEdges.find(sccEdge) == clearedEdges.end()) {
+          sccEdge->removeSubEdges();
+          clearedEdges.insert(sccEdge);
+        }
         sccEdge->addSubEdge(edge);
+      }
     }
   }
 }
@@ -194,11 +199,9 @@ void SCCDAG::mergeSCCs(std::set<DGNode<SCC> *> &sccSet) {
   }
 
   /*
-   * Note: nodes are from 2 contexts; internal nodes will point to external
-   * nodes, some of whose values are in nodes in this list, and some of whose
-   * values are NOT in nodes in this list. However, SCC's constructor accounts
-   * for that context mismatch and properly copies edges WITHOUT duplicating any
-   * nodes or edges.
+   * Note: SCCs refer to the nodes of the dependence graph they have been
+   * computed from. Hence, the new SCC is just a new view of these nodes: no
+   * node or edge gets copied.
    */
   auto mergeSCC = new SCC(mergeNodes);
 
@@ -214,6 +217,360 @@ void SCCDAG::mergeSCCs(std::set<DGNode<SCC> *> &sccSet) {
   this->markEdgesAndSubEdges();
 }
 
+void SCCDAG::removeDependences(
+    PDG *dependenceGraph,
+    std::unordered_set<DGEdge<Value, Value> *> const &edges) {
+  assert(dependenceGraph != nullptr);
+
+  /*
+   * Identify the SCCs that include an end of the dependences to remove.
+   * These SCCs include the dependences, so they need to be recomputed.
+   */
+  std::unordered_set<DGNode<SCC> *> oldSCCNodes;
+  for (auto edge : edges) {
+    for (auto value : { edge->getSrc(), edge->getDst() }) {
+      auto sccNodeIt = this->valueToSCCNode.find(value);
+      if (sccNodeIt == this->valueToSCCNode.end()) {
+        continue;
+      }
+      oldSCCNodes.insert(sccNodeIt->second);
+    }
+  }
+
+  /*
+   * Remove the dependences from the dependence graph.
+   */
+  for (auto edge : edges) {
+    dependenceGraph->removeEdge(edge);
+  }
+  if (oldSCCNodes.size() == 0) {
+    return;
+  }
+
+  /*
+   * Check if the reachability among SCCs can be updated locally.
+   * This is not the case if nodes have been added to the SCCDAG after having
+   * computed it (e.g., by merging SCCs).
+   */
+  auto canUpdateReachabilityLocally = !this->orderedDirty;
+  for (auto sccNode : this->getNodes()) {
+    if (sccNode->getT()->index == SCC::InvalidIndex) {
+      canUpdateReachabilityLocally = false;
+      break;
+    }
+  }
+
+  /*
+   * Collect the SCCs that can reach the SCCs to recompute.
+   * These are the only SCCs whose reachability can change.
+   */
+  std::unordered_set<DGNode<SCC> *> sccNodesToUpdate;
+  if (canUpdateReachabilityLocally) {
+    for (auto sccNode : this->getNodes()) {
+      if (oldSCCNodes.find(sccNode) != oldSCCNodes.end()) {
+        continue;
+      }
+      auto sccIndex = sccNode->getT()->index;
+      for (auto oldSCCNode : oldSCCNodes) {
+        auto oldSCCIndex = oldSCCNode->getT()->index;
+        if (this->ordered.test(sccIndex, oldSCCIndex)) {
+          sccNodesToUpdate.insert(sccNode);
+          break;
+        }
+      }
+    }
+  }
+
+  /*
+   * Collect the SCCs connected to the SCCs to recompute.
+   * Their dependences with the new SCCs will need to be added.
+   */
+  std::unordered_set<DGNode<SCC> *> neighbors;
+  for (auto oldSCCNode : oldSCCNodes) {
+    for (auto sccEdge : oldSCCNode->getAllEdges()) {
+      for (auto otherNode : { sccEdge->getSrcNode(), sccEdge->getDstNode() }) {
+        if (oldSCCNodes.find(otherNode) != oldSCCNodes.end()) {
+          continue;
+        }
+        neighbors.insert(otherNode);
+      }
+    }
+  }
+
+  /*
+   * Remove the old SCCs.
+   */
+  std::set<DGNode<Value> *> nodesToRecompute;
+  auto isEntryNodeRemoved = false;
+  for (auto oldSCCNode : oldSCCNodes) {
+    auto oldSCC = oldSCCNode->getT();
+    for (auto internalNodePair : oldSCC->internalNodePairs()) {
+      auto value = internalNodePair.first;
+      this->valueToSCCNode.erase(value);
+      nodesToRecompute.insert(internalNodePair.second);
+    }
+    if (oldSCC->index != SCC::InvalidIndex) {
+      this->freeSCCIndexes.push_back(oldSCC->index);
+      oldSCC->index = SCC::InvalidIndex;
+    }
+    isEntryNodeRemoved |= (oldSCCNode == this->entryNode);
+    this->removeNode(oldSCCNode);
+  }
+
+  /*
+   * Compute the new SCCs.
+   */
+  std::unordered_set<DGNode<SCC> *> newSCCNodes;
+  for (auto &sccNodes : SCCDAG::computeSCCsOf(nodesToRecompute)) {
+    auto scc = new SCC(sccNodes);
+    auto isInternal = false;
+    for (auto node : sccNodes) {
+      isInternal |= dependenceGraph->isInternal(node->getT());
+    }
+    auto newSCCNode = this->addNode(scc, /*inclusion=*/isInternal);
+    for (auto node : sccNodes) {
+      this->valueToSCCNode[node->getT()] = newSCCNode;
+    }
+    newSCCNodes.insert(newSCCNode);
+  }
+  if (isEntryNodeRemoved) {
+    this->entryNode = *newSCCNodes.begin();
+  }
+
+  /*
+   * Add the dependences of the new SCCs.
+   */
+  this->markEdgesAndSubEdgesOf(newSCCNodes, neighbors);
+
+  /*
+   * Update the reachability among SCCs.
+   */
+  if (!canUpdateReachabilityLocally) {
+    this->computeReachabilityAmongSCCs();
+    return;
+  }
+  sccNodesToUpdate.insert(newSCCNodes.begin(), newSCCNodes.end());
+  this->computeReachabilityOf(sccNodesToUpdate);
+
+  return;
+}
+
+std::vector<std::set<DGNode<Value> *>> SCCDAG::computeSCCsOf(
+    std::set<DGNode<Value> *> const &nodes) {
+
+  /*
+   * Tarjan's algorithm restricted to @nodes.
+   * The recursion is made explicit to avoid overflowing the stack on large
+   * SCCs.
+   */
+  std::vector<std::set<DGNode<Value> *>> sccs;
+  std::unordered_map<DGNode<Value> *, uint32_t> indexes;
+  std::unordered_map<DGNode<Value> *, uint32_t> lowLinks;
+  std::unordered_set<DGNode<Value> *> isOnStack;
+  std::vector<DGNode<Value> *> stack;
+  uint32_t nextIndex = 0;
+  for (auto root : nodes) {
+    if (indexes.find(root) != indexes.end()) {
+      continue;
+    }
+
+    /*
+     * Each frame is a node and the list of its successors still to visit.
+     */
+    std::vector<std::pair<DGNode<Value> *, std::vector<DGNode<Value> *>>>
+        frames;
+    auto pushFrame = [&](DGNode<Value> *node) {
+      indexes[node] = nextIndex;
+      lowLinks[node] = nextIndex;
+      nextIndex++;
+      stack.push_back(node);
+      isOnStack.insert(node);
+      std::vector<DGNode<Value> *> successors;
+      for (auto edge : node->getOutgoingEdges()) {
+        auto dstNode = edge->getDstNode();
+        if (nodes.find(dstNode) == nodes.end()) {
+          continue;
+        }
+        successors.push_back(dstNode);
+      }
+      frames.push_back(std::make_pair(node, std::move(successors)));
+    };
+    pushFrame(root);
+    while (!frames.empty()) {
+      auto node = frames.back().first;
+      auto &successors = frames.back().second;
+
+      /*
+       * Visit the next successor.
+       */
+      if (!successors.empty()) {
+        auto successor = successors.back();
+        successors.pop_back();
+        if (indexes.find(successor) == indexes.end()) {
+          pushFrame(successor);
+        } else if (isOnStack.find(successor) != isOnStack.end()) {
+          lowLinks[node] = std::min(lowLinks[node], indexes[successor]);
+        }
+        continue;
+      }
+
+      /*
+       * All successors have been visited.
+       * Check if @node is the root of an SCC.
+       */
+      frames.pop_back();
+      if (!frames.empty()) {
+        auto parent = frames.back().first;
+        lowLinks[parent] = std::min(lowLinks[parent], lowLinks[node]);
+      }
+      if (lowLinks[node] != indexes[node]) {
+        continue;
+      }
+      std::set<DGNode<Value> *> scc;
+      DGNode<Value> *sccNode = nullptr;
+      do {
+        sccNode = stack.back();
+        stack.pop_back();
+        isOnStack.erase(sccNode);
+        scc.insert(sccNode);
+      } while (sccNode != node);
+      sccs.push_back(std::move(scc));
+    }
+  }
+
+  return sccs;
+}
+
+void SCCDAG::markEdgesAndSubEdgesOf(
+    std::unordered_set<DGNode<SCC> *> const &newSCCNodes,
+    std::unordered_set<DGNode<SCC> *> const &neighbors) {
+
+  /*
+   * Dependences between two neighbors have not been removed.
+   * Hence, we only need to add those that have at least one end in a new SCC.
+   */
+  auto addEdgesFrom = [this, &newSCCNodes](DGNode<SCC> *outgoingSCCNode) {
+    auto isOutgoingSCCNew =
+        newSCCNodes.find(outgoingSCCNode) != newSCCNodes.end();
+    auto outgoingSCC = outgoingSCCNode->getT();
+    std::unordered_map<DGNode<SCC> *, DGEdge<SCC, SCC> *> sccEdges;
+    for (auto internalNodePair : outgoingSCC->internalNodePairs()) {
+      auto outgoingNode = internalNodePair.second;
+      for (auto edge : outgoingNode->getOutgoingEdges()) {
+        auto incomingValue = edge->getDst();
+        if (outgoingSCC->isInternal(incomingValue)) {
+          continue;
+        }
+        auto incomingSCCNode = this->valueToSCCNode.at(incomingValue);
+        if ((!isOutgoingSCCNew)
+            && (newSCCNodes.find(incomingSCCNode) == newSCCNodes.end())) {
+          continue;
+        }
+
+        /*
+         * Find or create the unique edge between the two SCCs.
+         */
+        auto &sccEdge = sccEdges[incomingSCCNode];
+        if (sccEdge == nullptr) {
+          sccEdge = this->addUndefinedDependenceEdge(outgoingSCC,
+                                                     incomingSCCNode->getT());
+        }
+        sccEdge->addSubEdge(edge);
+      }
+    }
+  };
+  for (auto sccNode : newSCCNodes) {
+    addEdgesFrom(sccNode);
+  }
+  for (auto sccNode : neighbors) {
+    addEdgesFrom(sccNode);
+  }
+
+  return;
+}
+
+void SCCDAG::computeReachabilityOf(
+    std::unordered_set<DGNode<SCC> *> &sccNodes) {
+
+  /*
+   * Assign the indexes to the new nodes.
+   */
+  for (auto sccNode : sccNodes) {
+    auto scc = sccNode->getT();
+    if (scc->index != SCC::InvalidIndex) {
+      continue;
+    }
+    if (this->freeSCCIndexes.empty()) {
+      auto oldSize = this->ordered.size();
+      auto newSize = std::max<uint32_t>(oldSize + 1, oldSize + oldSize / 4);
+      this->ordered.grow(newSize);
+      for (auto index = newSize; index > oldSize; index--) {
+        this->freeSCCIndexes.push_back(index - 1);
+      }
+    }
+    scc->index = this->freeSCCIndexes.back();
+    this->freeSCCIndexes.pop_back();
+  }
+
+  /*
+   * Reset the rows to recompute.
+   * Rows of unused indexes are reset as well, because they might belong to
+   * removed nodes.
+   * Only rows of @sccNodes can include the columns of removed nodes.
+   */
+  for (auto index : this->freeSCCIndexes) {
+    this->ordered.resetRow(index);
+  }
+  for (auto sccNode : sccNodes) {
+    this->ordered.resetRow(sccNode->getT()->index);
+  }
+
+  /*
+   * Compute the rows following a post-order of the SCCDAG so that the rows of
+   * the successors of a node are ready before the row of the node.
+   */
+  std::unordered_set<DGNode<SCC> *> visited;
+  std::vector<std::pair<DGNode<SCC> *, bool>> stack;
+  for (auto root : sccNodes) {
+    stack.push_back(std::make_pair(root, false));
+    while (!stack.empty()) {
+      auto sccNode = stack.back().first;
+      auto areSuccessorsReady = stack.back().second;
+      stack.pop_back();
+      if (!areSuccessorsReady) {
+        if (visited.find(sccNode) != visited.end()) {
+          continue;
+        }
+        visited.insert(sccNode);
+        stack.push_back(std::make_pair(sccNode, true));
+        for (auto sccEdge : sccNode->getOutgoingEdges()) {
+          auto dstNode = sccEdge->getDstNode();
+          if (sccNodes.find(dstNode) == sccNodes.end()) {
+            continue;
+          }
+          if (visited.find(dstNode) != visited.end()) {
+            continue;
+          }
+          stack.push_back(std::make_pair(dstNode, false));
+        }
+        continue;
+      }
+
+      /*
+       * Compute the row of @sccNode.
+       */
+      auto row = sccNode->getT()->index;
+      for (auto sccEdge : sccNode->getOutgoingEdges()) {
+        auto dstRow = sccEdge->getDst()->index;
+        this->ordered.set(row, dstRow);
+        this->ordered.unionRows(row, dstRow);
+      }
+    }
+  }
+
+  return;
+}
+
 SCC *SCCDAG::sccOfValue(Value *val) const {
   auto sccIter = valueToSCCNode.find(val);
   return sccIter == valueToSCCNode.end() ? nullptr : sccIter->second->getT();
@@ -361,9 +718,9 @@ bool SCCDAG::orderedBefore(const SCCSet &earlies, const SCC *lateSCC) const {
  */
 bool SCCDAG::orderedBefore(const SCC *earlySCC, const SCC *lateSCC) const {
   assert(!orderedDirty && "Must run computeReachabilityAmongSCCs() first");
-  auto earlySCCid = sccIndexes.find(earlySCC)->second;
-  auto lateSCCid = sccIndexes.find(lateSCC)->second;
-  return ordered.test(earlySCCid, lateSCCid);
+  assert(earlySCC->index != SCC::InvalidIndex);
+  assert(lateSCC->index != SCC::InvalidIndex);
+  return ordered.test(earlySCC->index, lateSCC->index);
 }
 
 void SCCDAG::computeReachabilityAmongSCCs(void) {
@@ -372,11 +729,45 @@ void SCCDAG::computeReachabilityAmongSCCs(void) {
 
   /*
    * Compute indices for all SCC nodes.
+   *
+   * Indices follow a topological order of the SCCDAG (Kahn's algorithm), so
+   * every dependence goes from a lower index to a higher one.
    */
+  freeSCCIndexes.clear();
+  std::unordered_map<DGNode<SCC> *, uint32_t> predecessorsToVisit;
+  std::vector<DGNode<SCC> *> readyNodes;
+  for (auto SCCNode : this->getNodes()) {
+    SCCNode->getT()->index = SCC::InvalidIndex;
+    auto predecessors = SCCNode->inDegree();
+    predecessorsToVisit[SCCNode] = predecessors;
+    if (predecessors == 0) {
+      readyNodes.push_back(SCCNode);
+    }
+  }
   uint32_t index = 0;
-  for (const auto *SCCNode : this->getNodes()) {
-    sccIndexes[SCCNode->getT()] = index;
+  while (!readyNodes.empty()) {
+    auto SCCNode = readyNodes.back();
+    readyNodes.pop_back();
+    SCCNode->getT()->index = index;
     index++;
+    for (auto SCCEdge : SCCNode->getOutgoingEdges()) {
+      auto dstNode = SCCEdge->getDstNode();
+      if (--predecessorsToVisit[dstNode] == 0) {
+        readyNodes.push_back(dstNode);
+      }
+    }
+  }
+
+  /*
+   * Nodes left without an index belong to cycles among SCCs (e.g., after
+   * merging SCCs).
+   */
+  auto isAcyclic = (index == Nscc);
+  for (auto SCCNode : this->getNodes()) {
+    if (SCCNode->getT()->index == SCC::InvalidIndex) {
+      SCCNode->getT()->index = index;
+      index++;
+    }
   }
 
   /*
@@ -390,35 +781,37 @@ void SCCDAG::computeReachabilityAmongSCCs(void) {
   for (auto *SCCEdge : this->getEdges()) {
     const SCC *srcSCC = SCCEdge->getSrc();
     const SCC *dstSCC = SCCEdge->getDst();
-    ordered.set(sccIndexes[srcSCC], sccIndexes[dstSCC]);
+    ordered.set(srcSCC->index, dstSCC->index);
   }
 
   /*
    * Compute transitive closure of the bitMatrix.
+   *
+   * For a DAG, rows are computed in reverse topological order: the rows of
+   * the successors of a node are final when the row of the node is computed,
+   * so each row is computed once by OR-ing the rows of its successors.
    */
-  ordered.transitiveClosure();
+  if (!isAcyclic) {
+    ordered.transitiveClosure();
+    return;
+  }
+  std::vector<uint32_t> reverseTopologicalOrder(Nscc);
+  for (uint32_t i = 0; i < Nscc; i++) {
+    reverseTopologicalOrder[i] = Nscc - 1 - i;
+  }
+  ordered.transitiveClosure(reverseTopologicalOrder);
 }
 
 uint32_t SCCDAG::getSCCIndex(const SCC *scc) const {
-  auto sccF = sccIndexes.find(scc);
-  return sccF->second;
+  assert(scc->index != SCC::InvalidIndex);
+  return scc->index;
 }
 
 SCCDAG::~SCCDAG() {
-  for (auto *edge : allEdges) {
-    if (edge) {
-      delete edge;
-    }
-  }
-
-  for (auto *node : allNodes) {
-    if (node) {
-      delete node;
-    }
-  }
-
-  this->clear();
 
+  /*
+   * Nodes and edges are released by the arena of DG<SCC>.
+   */
   return;
 }
 
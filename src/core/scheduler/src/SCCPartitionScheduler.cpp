@@ -248,6 +248,12 @@ std::unordered_set<Instruction *> SCCPartitionScheduler::
 
     for (auto edge : node->getIncomingEdges()) {
 
+      /*
+       * Ignore dependences that are not part of the SCC
+       */
+      if (!sccOfI->isIncluded(edge))
+        continue;
+
       /*
        * Ignore self edges
        */
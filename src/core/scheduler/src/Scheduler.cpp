@@ -855,8 +855,8 @@ void LoopScheduler::gatherNecessaryLoopState(void) {
   /*
    * Acquire loop blocks
    */
-  this->Blocks = std::set<BasicBlock *>(this->TheLoop->getBasicBlocks().begin(),
-                                        this->TheLoop->getBasicBlocks().end());
+  auto &loopBlocks = this->TheLoop->getBasicBlocks();
+  this->Blocks = std::set<BasicBlock *>(loopBlocks.begin(), loopBlocks.end());
 
   /*
    * Acquire exit edges
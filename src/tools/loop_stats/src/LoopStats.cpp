@@ -79,6 +79,23 @@ void LoopStats::collectStatsForLoops(Noelle &noelle,
    */
   printStatsHumanReadable(profiles);
 
+  /*
+   * Print the time spent computing the sub-analyses of each loop.
+   */
+  if (noelle.getVerbosity() >= Verbosity::Maximal) {
+    for (auto loopContent : loops) {
+      auto loopStructure = loopContent->getLoopStructure();
+      auto loopIDOpt = loopStructure->getID();
+      assert(loopIDOpt);
+      errs() << "LoopStats: Analysis times of loop " << loopIDOpt.value()
+             << "\n";
+      for (auto &analysisTime : loopContent->getAnalysisTimes()) {
+        errs() << "LoopStats:   " << analysisTime.first << ": "
+               << analysisTime.second << " us\n";
+      }
+    }
+  }
+
   return;
 }
 
@@ -53,7 +53,11 @@ bool PDGEmbedder::runOnModule(Module &M) {
    * Embed the PDG.
    */
   auto pdgGen = noelle.getPDGGenerator();
-  pdgGen.cleanAndEmbedPDGAsMetadata(pdg);
+  if (pdgGen.isPDGSidecarEnabled()) {
+    pdgGen.cleanAndEmbedPDGAsSidecar(pdg);
+  } else {
+    pdgGen.cleanAndEmbedPDGAsMetadata(pdg);
+  }
 
   return true;
 }
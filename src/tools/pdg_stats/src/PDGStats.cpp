@@ -19,6 +19,8 @@
  OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
  OR OTHER DEALINGS IN THE SOFTWARE.
  */
+#include <chrono>
+#include <random>
 #include "arcana/noelle/core/PDGPrinter.hpp"
 #include "arcana/noelle/core/SystemHeaders.hpp"
 #include "PDGStats.hpp"
@@ -48,6 +50,11 @@ bool PDGStats::runOnModule(Module &M) {
       continue;
     }
 
+    /*
+     * The SCCDAGs of all these loops are used below.
+     */
+    noelle.computeSCCDAGs(*programLoops[&F]);
+
     /*
      * Create the map from loop structure to LoopContent.
      */
@@ -79,6 +86,28 @@ bool PDGStats::runOnModule(Module &M) {
     this->analyzeDependence(edge);
   }
 
+  /*
+   * Collect the statistics about the memory used by the PDG.
+   */
+  auto &pdgArena = PDG->getArena();
+  this->pdgArenaBytes = pdgArena.getBytesAllocated();
+  this->pdgArenaSlabBytes = pdgArena.getTotalMemory();
+  this->pdgArenaSlabs = pdgArena.getNumberOfSlabs();
+
+  /*
+   * Compare the data-flow engines.
+   */
+  if (this->compareDataFlowEngines) {
+    this->compareDataFlowEnginesOnReachability(noelle, M);
+  }
+
+  /*
+   * Benchmark the reachability among SCCs.
+   */
+  if (this->benchmarkSCCDAGs) {
+    this->benchmarkReachabilityAmongSCCs(PDG, M);
+  }
+
   /*
    * Collect the statistics for all functions.
    */
@@ -100,6 +129,16 @@ bool PDGStats::runOnModule(Module &M) {
    */
   printStats();
 
+  /*
+   * Print the profiles of the dependence analyses.
+   */
+  this->printDependenceAnalysisProfiles(
+      "PDG",
+      noelle.getPDGGenerator().getDependenceAnalyses());
+  this->printDependenceAnalysisProfiles(
+      "loop dependence graphs",
+      noelle.getLDGGenerator().getDependenceAnalyses());
+
   return false;
 }
 
@@ -155,7 +194,7 @@ void PDGStats::collectStatsForPotentialEdges(
                       &totStores,
                       &totCalls](LoopTree *n, uint32_t level) -> bool {
         auto currentLoop = n->getLoop();
-        for (auto inst : currentLoop->getInstructions()) {
+        for (auto inst : currentLoop->instructions()) {
           if (isa<LoadInst>(inst)) {
             totLoads++;
             continue;
@@ -255,6 +294,19 @@ void PDGStats::collectStatsForLoopEdges(
           this->analyzeDependence(edge);
         }
 
+        /*
+         * Collect the statistics about the memory used by the loop graphs.
+         */
+        auto loopDGBytes = loopDG->getArena().getBytesAllocated();
+        this->totLoopDGArenaBytes += loopDGBytes;
+        this->maxLoopDGArenaBytes =
+            std::max(this->maxLoopDGArenaBytes, loopDGBytes);
+        auto sccdag = currentLoopContent->getSCCManager()->getSCCDAG();
+        auto sccdagBytes = sccdag->getArena().getBytesAllocated();
+        this->totSCCDAGArenaBytes += sccdagBytes;
+        this->maxSCCDAGArenaBytes =
+            std::max(this->maxSCCDAGArenaBytes, sccdagBytes);
+
         return false;
       };
       loopTree->visitPreOrder(visitor);
@@ -296,6 +348,16 @@ void PDGStats::printStats() {
          << "\n";
   errs() << "     Number of potential memory dependences: "
          << this->numberOfPotentialMemoryDependences << "\n";
+  errs() << "PDG arena high-water mark (bytes): " << this->pdgArenaBytes
+         << "\n";
+  errs() << " PDG arena slabs: " << this->pdgArenaSlabs << " ("
+         << this->pdgArenaSlabBytes << " bytes)\n";
+  errs() << "Loop DG arenas high-water mark (bytes): max "
+         << this->maxLoopDGArenaBytes << ", total "
+         << this->totLoopDGArenaBytes << "\n";
+  errs() << "SCCDAG arenas high-water mark (bytes): max "
+         << this->maxSCCDAGArenaBytes << ", total "
+         << this->totSCCDAGArenaBytes << "\n";
 
   return;
 }
@@ -365,8 +427,221 @@ void PDGStats::analyzeDependence(DGEdge<Value, Value> *edge) {
   return;
 }
 
+void PDGStats::compareDataFlowEnginesOnReachability(Noelle &noelle,
+                                                    Module &M) {
+  using Clock = std::chrono::steady_clock;
+  auto elapsedMs = [](Clock::time_point start) -> double {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start)
+        .count();
+  };
+
+  /*
+   * Define the reachability analysis for the std::function based engine.
+   */
+  auto computeGEN = [](Instruction *i, DataFlowResult *df) {
+    df->GEN(i).insert(i);
+    return;
+  };
+  auto computeOUT = [](Instruction *inst,
+                       Instruction *succ,
+                       std::set<Value *> &OUT,
+                       DataFlowResult *df) {
+    auto &inS = df->IN(succ);
+    OUT.insert(inS.begin(), inS.end());
+    return;
+  };
+  auto computeIN =
+      [](Instruction *inst, std::set<Value *> &IN, DataFlowResult *df) {
+        auto &genI = df->GEN(inst);
+        auto &outI = df->OUT(inst);
+        IN.insert(outI.begin(), outI.end());
+        IN.insert(genI.begin(), genI.end());
+        return;
+      };
+
+  /*
+   * Run both engines on every function.
+   */
+  auto dfe = noelle.getDataFlowEngine();
+  auto dfa = noelle.getDataFlowAnalyses();
+  double stdFunctionEngineTime = 0;
+  double staticEngineTime = 0;
+  uint64_t functions = 0;
+  uint64_t mismatches = 0;
+  for (auto &F : M) {
+    if (F.empty()) {
+      continue;
+    }
+    functions++;
+
+    auto start = Clock::now();
+    auto stdFunctionDFR =
+        dfe.applyBackward(&F, computeGEN, computeIN, computeOUT);
+    stdFunctionEngineTime += elapsedMs(start);
+
+    start = Clock::now();
+    auto staticDFR = dfa.runReachableAnalysis(&F);
+    staticEngineTime += elapsedMs(start);
+
+    /*
+     * Check that the two engines agree.
+     */
+    for (auto &inst : instructions(F)) {
+      if (stdFunctionDFR->OUT(&inst) != staticDFR->OUT(&inst)) {
+        mismatches++;
+      }
+    }
+
+    delete stdFunctionDFR;
+    delete staticDFR;
+  }
+
+  /*
+   * Print the comparison.
+   */
+  errs() << "Data-flow engine comparison (reachability)\n";
+  errs() << " Functions: " << functions << "\n";
+  errs() << " Time of the std::function engine (ms): "
+         << stdFunctionEngineTime << "\n";
+  errs() << " Time of the static engine (ms): " << staticEngineTime << "\n";
+  errs() << " Instructions with different results: " << mismatches << "\n";
+
+  return;
+}
+
+void PDGStats::benchmarkReachabilityAmongSCCs(PDG *pdg, Module &M) {
+  using Clock = std::chrono::steady_clock;
+  auto elapsedMs = [](Clock::time_point start) -> double {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start)
+        .count();
+  };
+
+  /*
+   * Compute the closure of @adjacency with both algorithms and check they
+   * agree.
+   * Return the times of the worklist and of the topological algorithms.
+   * Nodes of @adjacency must be numbered in topological order.
+   */
+  uint64_t mismatches = 0;
+  auto compareClosures = [&mismatches, &elapsedMs](BitMatrix &adjacency) {
+    auto n = adjacency.size();
+    BitMatrix worklistClosure = adjacency;
+    auto start = Clock::now();
+    worklistClosure.transitiveClosure();
+    auto worklistTime = elapsedMs(start);
+
+    std::vector<uint32_t> reverseTopologicalOrder(n);
+    for (auto i = 0u; i < n; i++) {
+      reverseTopologicalOrder[i] = n - 1 - i;
+    }
+    BitMatrix topologicalClosure = adjacency;
+    start = Clock::now();
+    topologicalClosure.transitiveClosure(reverseTopologicalOrder);
+    auto topologicalTime = elapsedMs(start);
+
+    for (auto row = 0u; row < n; row++) {
+      for (auto col = 0u; col < n; col++) {
+        if (worklistClosure.test(row, col)
+            != topologicalClosure.test(row, col)) {
+          mismatches++;
+        }
+      }
+    }
+
+    return std::make_pair(worklistTime, topologicalTime);
+  };
+
+  /*
+   * Synthetic SCCDAGs.
+   * They mimic large unrolled loop bodies: most dependences connect SCCs that
+   * are close to each other.
+   */
+  errs() << "SCCDAG reachability benchmark\n";
+  std::mt19937 generator(42);
+  for (uint32_t n : { 1000u, 4000u }) {
+    BitMatrix adjacency(n);
+    for (auto i = 0u; i + 1 < n; i++) {
+      for (auto j = 0u; j < 3; j++) {
+        auto distance = 1 + (generator() % 16);
+        if ((generator() % 8) == 0) {
+          distance = 1 + (generator() % n);
+        }
+        if ((i + distance) < n) {
+          adjacency.set(i, i + distance);
+        }
+      }
+    }
+    auto times = compareClosures(adjacency);
+    errs() << " Synthetic SCCDAG with " << n << " SCCs\n";
+    errs() << "  Time of the worklist closure (ms): " << times.first << "\n";
+    errs() << "  Time of the topological closure (ms): " << times.second
+           << "\n";
+  }
+
+  /*
+   * SCCDAGs of the functions of the program.
+   */
+  double sccdagTime = 0;
+  double worklistTime = 0;
+  double topologicalTime = 0;
+  uint64_t sccdags = 0;
+  uint64_t sccs = 0;
+  for (auto &F : M) {
+    if (F.empty()) {
+      continue;
+    }
+    auto functionDG = pdg->createFunctionSubgraph(F);
+    auto start = Clock::now();
+    auto sccdag = new SCCDAG(functionDG);
+    sccdagTime += elapsedMs(start);
+    sccdags++;
+
+    BitMatrix adjacency(sccdag->numNodes());
+    for (auto sccEdge : sccdag->getEdges()) {
+      adjacency.set(sccdag->getSCCIndex(sccEdge->getSrc()),
+                    sccdag->getSCCIndex(sccEdge->getDst()));
+    }
+    sccs += sccdag->numNodes();
+    auto times = compareClosures(adjacency);
+    worklistTime += times.first;
+    topologicalTime += times.second;
+
+    delete sccdag;
+    delete functionDG;
+  }
+  errs() << " Function SCCDAGs: " << sccdags << " (" << sccs << " SCCs)\n";
+  errs() << "  Time to build the SCCDAGs (ms): " << sccdagTime << "\n";
+  errs() << "  Time of the worklist closure (ms): " << worklistTime << "\n";
+  errs() << "  Time of the topological closure (ms): " << topologicalTime
+         << "\n";
+  errs() << " Closures with different results: " << mismatches << "\n";
+
+  return;
+}
+
 PDGStats::~PDGStats() {
   return;
 }
 
+void PDGStats::printDependenceAnalysisProfiles(
+    std::string dgName,
+    const DependenceAnalysisDispatcher &analyses) {
+  auto profiles = analyses.getProfiles();
+  if (profiles.empty()) {
+    return;
+  }
+
+  errs() << "Dependence analyses used to compute the " << dgName << "\n";
+  for (auto &profile : profiles) {
+    errs() << " " << profile.name << "\n";
+    errs() << "   Queries: " << profile.queries << "\n";
+    errs() << "   Queries answered by the cache: " << profile.cachedQueries
+           << "\n";
+    errs() << "   Dependences disproved: " << profile.independences << "\n";
+    errs() << "   Time (ms): " << (profile.seconds * 1000) << "\n";
+  }
+
+  return;
+}
+
 } // namespace arcana::noelle
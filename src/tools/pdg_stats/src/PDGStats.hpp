@@ -46,6 +46,8 @@ public:
 
 private:
   bool dumpLoopDG = false;
+  bool compareDataFlowEngines = false;
+  bool benchmarkSCCDAGs = false;
   int64_t numberOfNodes = 0;
   int64_t numberOfEdges = 0;
   int64_t numberOfVariableDependence = 0;
@@ -53,6 +55,13 @@ private:
   int64_t numberOfMemoryMustDependence = 0;
   int64_t numberOfPotentialMemoryDependences = 0;
   int64_t numberOfControlDependence = 0;
+  uint64_t pdgArenaBytes = 0;
+  uint64_t pdgArenaSlabBytes = 0;
+  uint64_t pdgArenaSlabs = 0;
+  uint64_t maxLoopDGArenaBytes = 0;
+  uint64_t totLoopDGArenaBytes = 0;
+  uint64_t maxSCCDAGArenaBytes = 0;
+  uint64_t totSCCDAGArenaBytes = 0;
 
   void collectStatsForNodes(Function &F);
   void collectStatsForPotentialEdges(
@@ -73,8 +82,15 @@ private:
 
   void analyzeDependence(DGEdge<Value, Value> *edge);
 
+  void compareDataFlowEnginesOnReachability(Noelle &noelle, Module &M);
+
+  void benchmarkReachabilityAmongSCCs(PDG *pdg, Module &M);
+
   bool edgeIsDependenceOf(MDNode *edgeM, EDGE_ATTRIBUTE edgeAttribute);
   void printStats();
+  void printDependenceAnalysisProfiles(
+      std::string dgName,
+      const DependenceAnalysisDispatcher &analyses);
   uint64_t computePotentialEdges(uint64_t totLoads,
                                  uint64_t totStores,
                                  uint64_t totCalls);
@@ -29,9 +29,22 @@ static cl::opt<bool> LoopDGDump("noelle-refined-loopdg-dump",
                                 cl::ZeroOrMore,
                                 cl::Hidden,
                                 cl::desc("Dump the refined Loop DG"));
+static cl::opt<bool> DataFlowEngineStats(
+    "noelle-pdg-stats-dataflow",
+    cl::ZeroOrMore,
+    cl::Hidden,
+    cl::desc("Compare the data-flow engines on the reachability analysis"));
+
+static cl::opt<bool> SCCDAGReachabilityStats(
+    "noelle-pdg-stats-sccdag",
+    cl::ZeroOrMore,
+    cl::Hidden,
+    cl::desc("Benchmark the computation of the reachability among SCCs"));
 
 bool PDGStats::doInitialization(Module &M) {
   this->dumpLoopDG = LoopDGDump;
+  this->compareDataFlowEngines = DataFlowEngineStats;
+  this->benchmarkSCCDAGs = SCCDAGReachabilityStats;
   return false;
 }
 
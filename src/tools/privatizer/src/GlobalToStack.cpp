@@ -485,6 +485,11 @@ bool Privatizer::transformG2S(Noelle &noelle,
     errs() << prefix << "Replace global variable @" << globalVarName << "\n";
     errs() << emptyPrefix << "with allocaInst: " << *allocaInst << "\n";
     errs() << emptyPrefix << suffix;
+
+    /*
+     * The points-to info of the current function is now stale.
+     */
+    mpa.invalidate(currentF);
   }
 
   return modified;
@@ -212,6 +212,7 @@ bool Privatizer::transformH2S(Noelle &noelle, LiveMemorySummary liveMemSum) {
     }
 
     modified = true;
+    mpa.invalidate(currentF);
     auto entryBlock = &currentF->getEntryBlock();
     auto firstInst = entryBlock->getFirstNonPHI();
     IRBuilder<> entryBuilder(firstInst);
@@ -259,6 +260,7 @@ bool Privatizer::transformH2S(Noelle &noelle, LiveMemorySummary liveMemSum) {
    * Remove dead instructions.
    */
   for (auto freeInst : liveMemSum.removable) {
+    mpa.invalidate(freeInst->getFunction());
     freeInst->eraseFromParent();
   }
 
@@ -145,7 +145,7 @@ void ReplDriver::selectFn() {
          << "::" << ls->getHeader()->getName() << '\n';
   selectedLoop = loop;
 
-  selectedPDG = std::make_unique<PDG>(*loop->getLoopDG());
+  selectedPDG.reset(loop->getLoopDG()->clone(true));
   selectedSCCDAG = std::make_unique<SCCDAG>(selectedPDG.get());
 
   createInstIdMap(M, selectedPDG.get());
@@ -267,9 +267,8 @@ void ReplDriver::removeFn() {
   }
 
   auto dep = depIdMap->at(depId);
-  selectedPDG->removeEdge(dep);
-  // update SCCDAG
-  selectedSCCDAG = std::make_unique<SCCDAG>(selectedPDG.get());
+  // remove the dependence and update SCCDAG
+  selectedSCCDAG->removeDependences(selectedPDG.get(), { dep });
 }
 
 void ReplDriver::removeAllFn() {
@@ -285,20 +284,17 @@ void ReplDriver::removeAllFn() {
   }
 
   auto node = instIdMap->at(instId);
-  list<llvm::noelle::DGEdge<Value, Value> *> edgesToRemove;
+  std::unordered_set<llvm::noelle::DGEdge<Value, Value> *> edgesToRemove;
   for (auto &edge : node->getSrcEdges()) {
-    edgesToRemove.push_back(edge);
+    edgesToRemove.insert(edge);
   }
 
   for (auto &edge : node->getDstEdges()) {
-    edgesToRemove.push_back(edge);
+    edgesToRemove.insert(edge);
   }
 
-  for (auto edge : edgesToRemove) {
-    selectedPDG->removeEdge(edge);
-  }
-  // update SCCDAG
-  selectedSCCDAG = std::make_unique<SCCDAG>(selectedPDG.get());
+  // remove the dependences and update SCCDAG
+  selectedSCCDAG->removeDependences(selectedPDG.get(), edgesToRemove);
 }
 
 void ReplDriver::parallelizeFn() {
@@ -0,0 +1,229 @@
+/*
+ * Copyright 2016 - 2024  Angelo Matni, Simone Campanoni
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "ArchTestSuite.hpp"
+
+using namespace llvm;
+using namespace arcana::noelle;
+
+/*
+ * The fake sysfs tree stored in the directory of the test.
+ * It describes 8 logical cores: 4 physical cores with 2-way SMT, split
+ * between 2 NUMA nodes, and a 128-byte cache line.
+ */
+static const std::string fakeSystemRoot = "sysfs";
+
+// Register pass to "opt"
+char ArchTestSuite::ID = 0;
+static RegisterPass<ArchTestSuite> X("UnitTester", "Architecture Unit Tester");
+
+// Register pass to "clang"
+static ArchTestSuite *_PassMaker = NULL;
+static RegisterStandardPasses _RegPass1(PassManagerBuilder::EP_OptimizerLast,
+                                        [](const PassManagerBuilder &,
+                                           legacy::PassManagerBase &PM) {
+                                          if (!_PassMaker) {
+                                            PM.add(_PassMaker =
+                                                       new ArchTestSuite());
+                                          }
+                                        }); // ** for -Ox
+static RegisterStandardPasses _RegPass2(
+    PassManagerBuilder::EP_EnabledOnOptLevel0,
+    [](const PassManagerBuilder &, legacy::PassManagerBase &PM) {
+      if (!_PassMaker) {
+        PM.add(_PassMaker = new ArchTestSuite());
+      }
+    }); // ** for -O0
+
+const char *ArchTestSuite::tests[] = {
+  "physical cores",
+  "logical cores per physical core",
+  "NUMA nodes",
+  "caches",
+  "missing system root",
+};
+TestFunction ArchTestSuite::testFns[] = {
+  ArchTestSuite::physicalCoresAreCorrect,
+  ArchTestSuite::smtIsCorrect,
+  ArchTestSuite::numaNodesAreCorrect,
+  ArchTestSuite::cachesAreCorrect,
+  ArchTestSuite::missingSystemRootFallsBack,
+};
+
+bool ArchTestSuite::doInitialization(Module &M) {
+  errs() << "ArchTestSuite: Initialize\n";
+  const int numTests = sizeof(tests) / sizeof(tests[0]);
+  this->suite =
+      new TestSuite("ArchTestSuite", tests, testFns, numTests, "test.txt");
+  this->M = &M;
+  return false;
+}
+
+void ArchTestSuite::getAnalysisUsage(AnalysisUsage &AU) const {
+  AU.setPreservesAll();
+}
+
+bool ArchTestSuite::runOnModule(Module &M) {
+  errs() << "ArchTestSuite: Start\n";
+
+  suite->runTests((ModulePass &)*this);
+
+  /*
+   * Read the topology of the machine again for whoever runs after us.
+   */
+  Architecture::setSystemRoot("/sys");
+
+  return false;
+}
+
+std::string ArchTestSuite::coresToString(std::vector<uint32_t> const &cores) {
+  if (cores.empty()) {
+    return "none";
+  }
+  std::string str;
+  for (auto core : cores) {
+    if (!str.empty()) {
+      str += " ";
+    }
+    str += std::to_string(core);
+  }
+
+  return str;
+}
+
+Values ArchTestSuite::physicalCoresAreCorrect(ModulePass &pass,
+                                              TestSuite &suite) {
+  Architecture::setSystemRoot(fakeSystemRoot);
+
+  Values values;
+  values.insert("Logical cores: "
+                + std::to_string(Architecture::getNumberOfLogicalCores()));
+  values.insert("Physical cores: "
+                + std::to_string(Architecture::getNumberOfPhysicalCores()));
+
+  return values;
+}
+
+Values ArchTestSuite::smtIsCorrect(ModulePass &pass, TestSuite &suite) {
+  Architecture::setSystemRoot(fakeSystemRoot);
+
+  Values values;
+  values.insert(
+      "Logical cores per physical core: "
+      + std::to_string(Architecture::getNumberOfLogicalCoresPerPhysicalCore()));
+
+  return values;
+}
+
+Values ArchTestSuite::numaNodesAreCorrect(ModulePass &pass,
+                                          TestSuite &suite) {
+  Architecture::setSystemRoot(fakeSystemRoot);
+
+  Values values;
+  auto nodes = Architecture::getNumberOfNUMANodes();
+  values.insert("NUMA nodes: " + std::to_string(nodes));
+
+  /*
+   * Check the two directions of the mapping between cores and nodes.
+   */
+  for (auto node = 0u; node <= nodes; node++) {
+    values.insert(
+        "Cores of NUMA node " + std::to_string(node) + ": "
+        + ArchTestSuite::coresToString(
+            Architecture::getLogicalCoresOfNUMANode(node)));
+  }
+  std::vector<uint32_t> nodeOfCores;
+  for (auto core = 0u; core < Architecture::getNumberOfLogicalCores();
+       core++) {
+    nodeOfCores.push_back(Architecture::getNUMANodeOfLogicalCore(core));
+  }
+  values.insert("NUMA node of each core: "
+                + ArchTestSuite::coresToString(nodeOfCores));
+
+  return values;
+}
+
+Values ArchTestSuite::cachesAreCorrect(ModulePass &pass, TestSuite &suite) {
+  Architecture::setSystemRoot(fakeSystemRoot);
+
+  Values values;
+  auto levels = Architecture::getNumberOfCacheLevels();
+  values.insert("Cache levels: " + std::to_string(levels));
+
+  /*
+   * The L1 instruction cache must be ignored and unknown levels must be 0.
+   */
+  for (auto level = 1u; level <= (levels + 1); level++) {
+    values.insert("L" + std::to_string(level) + " bytes: "
+                  + std::to_string(Architecture::getCacheBytes(level)));
+  }
+  values.insert("Cache line bytes: "
+                + std::to_string(Architecture::getCacheLineBytes()));
+
+  return values;
+}
+
+Values ArchTestSuite::missingSystemRootFallsBack(ModulePass &pass,
+                                                 TestSuite &suite) {
+  Architecture::setSystemRoot("sysfs_that_does_not_exist");
+
+  /*
+   * Without sysfs, the logical cores are the ones the C++ runtime reports and
+   * two-way SMT is assumed.
+   */
+  Values values;
+  uint32_t logicalCores = std::max(std::thread::hardware_concurrency(), 1u);
+  if (Architecture::getNumberOfLogicalCores() == logicalCores) {
+    values.insert("Logical cores match the runtime");
+  }
+  uint32_t physicalCores = std::max(logicalCores / 2, 1u);
+  if (Architecture::getNumberOfPhysicalCores() == physicalCores) {
+    values.insert("Physical cores are half of the logical cores");
+  }
+  if (Architecture::getNumberOfLogicalCoresPerPhysicalCore()
+      == std::max(logicalCores / physicalCores, 1u)) {
+    values.insert("Logical cores per physical core match");
+  }
+
+  /*
+   * All cores belong to a single NUMA node.
+   */
+  values.insert("NUMA nodes: "
+                + std::to_string(Architecture::getNumberOfNUMANodes()));
+  if (Architecture::getLogicalCoresOfNUMANode(0).size() == logicalCores) {
+    values.insert("All cores are in NUMA node 0");
+  }
+  auto lastCore = logicalCores - 1;
+  values.insert(
+      "NUMA node of the last core: "
+      + std::to_string(Architecture::getNUMANodeOfLogicalCore(lastCore)));
+
+  /*
+   * Caches are unknown and the cache line is the default one.
+   */
+  values.insert("Cache levels: "
+                + std::to_string(Architecture::getNumberOfCacheLevels()));
+  values.insert("L1 bytes: " + std::to_string(Architecture::getCacheBytes(1)));
+  values.insert("Cache line bytes: "
+                + std::to_string(Architecture::getCacheLineBytes()));
+
+  return values;
+}
@@ -0,0 +1,11 @@
+#include <stdio.h>
+
+int main (int argc, char *argv[]){
+  int s = 0;
+  for (int i = 0; i < argc; ++i) {
+    s += i;
+  }
+
+  printf("%d\n", s);
+  return 0;
+}
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../dependence_analysis_dispatcher.pdb"
+  "../dependence_analysis_dispatcher.so"
+  "CMakeFiles/dependence_analysis_dispatcher.dir/DADTestSuite.cpp.o"
+  "CMakeFiles/dependence_analysis_dispatcher.dir/DADTestSuite.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dependence_analysis_dispatcher.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
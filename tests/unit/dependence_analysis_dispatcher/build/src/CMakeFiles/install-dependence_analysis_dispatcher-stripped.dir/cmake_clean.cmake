@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/install-dependence_analysis_dispatcher-stripped"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/install-dependence_analysis_dispatcher-stripped.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
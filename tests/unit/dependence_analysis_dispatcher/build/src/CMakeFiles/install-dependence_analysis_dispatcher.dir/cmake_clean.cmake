@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/install-dependence_analysis_dispatcher"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/install-dependence_analysis_dispatcher.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
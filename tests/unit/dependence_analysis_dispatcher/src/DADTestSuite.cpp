@@ -0,0 +1,343 @@
+/*
+ * Copyright 2016 - 2024  Angelo Matni, Simone Campanoni
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "DADTestSuite.hpp"
+
+using namespace llvm;
+using namespace arcana::noelle;
+
+// Register pass to "opt"
+char DADTestSuite::ID = 0;
+static RegisterPass<DADTestSuite> X(
+    "UnitTester",
+    "Dependence Analysis Dispatcher Unit Tester");
+
+// Register pass to "clang"
+static DADTestSuite *_PassMaker = NULL;
+static RegisterStandardPasses _RegPass1(PassManagerBuilder::EP_OptimizerLast,
+                                        [](const PassManagerBuilder &,
+                                           legacy::PassManagerBase &PM) {
+                                          if (!_PassMaker) {
+                                            PM.add(_PassMaker =
+                                                       new DADTestSuite());
+                                          }
+                                        }); // ** for -Ox
+static RegisterStandardPasses _RegPass2(
+    PassManagerBuilder::EP_EnabledOnOptLevel0,
+    [](const PassManagerBuilder &, legacy::PassManagerBase &PM) {
+      if (!_PassMaker) {
+        PM.add(_PassMaker = new DADTestSuite());
+      }
+    }); // ** for -O0
+
+const char *DADTestSuite::tests[] = {
+  "independence wins over must dependence",
+  "must dependence wins over may dependence",
+  "analyses are invoked in insertion order",
+  "verdicts of intraprocedural analyses are cached",
+  "verdicts of other analyses are not cached",
+  "verdicts about calls are not cached",
+};
+TestFunction DADTestSuite::testFns[] = {
+  DADTestSuite::independenceWinsOverMustDependence,
+  DADTestSuite::mustDependenceWinsOverMayDependence,
+  DADTestSuite::analysesAreInvokedInInsertionOrder,
+  DADTestSuite::intraproceduralVerdictsAreCached,
+  DADTestSuite::otherVerdictsAreNotCached,
+  DADTestSuite::verdictsAboutCallsAreNotCached,
+};
+
+FixedVerdictAnalysis::FixedVerdictAnalysis(
+    const std::string &name,
+    MemoryDataDependenceStrength verdict,
+    std::vector<std::string> &invocations)
+  : DependenceAnalysis{ name },
+    verdict{ verdict },
+    intraprocedural{ false },
+    invocations{ invocations } {
+  return;
+}
+
+MemoryDataDependenceStrength FixedVerdictAnalysis::
+    isThereThisMemoryDataDependenceType(DataDependenceType t,
+                                        Instruction *fromInst,
+                                        Instruction *toInst,
+                                        Function &function) {
+  this->invocations.push_back(this->getName());
+  return this->verdict;
+}
+
+MemoryDataDependenceStrength FixedVerdictAnalysis::
+    isThereThisMemoryDataDependenceType(DataDependenceType t,
+                                        Instruction *fromInst,
+                                        Instruction *toInst,
+                                        LoopStructure &loop) {
+  this->invocations.push_back(this->getName());
+  return this->verdict;
+}
+
+bool FixedVerdictAnalysis::isIntraprocedural(void) const {
+  return this->intraprocedural;
+}
+
+bool DADTestSuite::doInitialization(Module &M) {
+  errs() << "DADTestSuite: Initialize\n";
+  const int numTests = sizeof(tests) / sizeof(tests[0]);
+  this->suite =
+      new TestSuite("DADTestSuite", tests, testFns, numTests, "test.txt");
+  this->M = &M;
+  return false;
+}
+
+void DADTestSuite::getAnalysisUsage(AnalysisUsage &AU) const {
+  AU.addRequired<NoellePass>();
+  AU.setPreservesAll();
+}
+
+bool DADTestSuite::runOnModule(Module &M) {
+  errs() << "DADTestSuite: Start\n";
+  this->noelle = &getAnalysis<NoellePass>().getNoelle();
+
+  /*
+   * Fetch the loop of main and the memory accesses it includes.
+   */
+  auto mainF = M.getFunction("main");
+  auto loops = this->noelle->getLoopStructures(mainF, 0);
+  this->loop = loops->front();
+  this->store = nullptr;
+  this->load = nullptr;
+  this->call = nullptr;
+  for (auto inst : this->loop->getInstructions()) {
+    if (auto s = dyn_cast<StoreInst>(inst)) {
+      this->store = s;
+    } else if (auto l = dyn_cast<LoadInst>(inst)) {
+      this->load = l;
+    } else if (auto c = dyn_cast<CallBase>(inst)) {
+      this->call = c;
+    }
+  }
+  assert((this->store != nullptr) && (this->load != nullptr)
+         && (this->call != nullptr));
+
+  suite->runTests((ModulePass &)*this);
+
+  return false;
+}
+
+std::pair<MemoryDataDependenceStrength, MemoryDataDependenceStrength>
+DADTestSuite::dispatch(
+    DADTestSuite &pass,
+    std::vector<MemoryDataDependenceStrength> const &verdicts) {
+  std::vector<std::string> invocations;
+  std::vector<FixedVerdictAnalysis *> analyses;
+  DependenceAnalysisDispatcher dispatcher;
+  for (auto verdict : verdicts) {
+    auto a = new FixedVerdictAnalysis(DADTestSuite::getName(verdict),
+                                      verdict,
+                                      invocations);
+    analyses.push_back(a);
+    dispatcher.addAnalysis(a);
+  }
+
+  auto &F = *pass.loop->getFunction();
+  auto functionVerdict =
+      dispatcher.isThereThisMemoryDataDependenceType(DG_DATA_RAW,
+                                                     pass.store,
+                                                     pass.load,
+                                                     F);
+  auto loopVerdict =
+      dispatcher.isThereThisMemoryDataDependenceType(DG_DATA_RAW,
+                                                     pass.store,
+                                                     pass.load,
+                                                     *pass.loop);
+
+  for (auto a : analyses) {
+    delete a;
+  }
+
+  return std::make_pair(functionVerdict, loopVerdict);
+}
+
+std::pair<MemoryDataDependenceStrength, uint64_t> DADTestSuite::queryTwice(
+    DADTestSuite &pass,
+    bool intraprocedural,
+    Instruction *toInst) {
+  std::vector<std::string> invocations;
+  FixedVerdictAnalysis a("fixed", MUST_EXIST, invocations);
+  a.intraprocedural = intraprocedural;
+  DependenceAnalysisDispatcher dispatcher;
+  dispatcher.addAnalysis(&a);
+  dispatcher.refreshCache(*pass.loop->getFunction());
+
+  dispatcher.isThereThisMemoryDataDependenceType(DG_DATA_RAW,
+                                                 pass.store,
+                                                 toInst,
+                                                 *pass.loop);
+  a.verdict = CANNOT_EXIST;
+  auto verdict =
+      dispatcher.isThereThisMemoryDataDependenceType(DG_DATA_RAW,
+                                                     pass.store,
+                                                     toInst,
+                                                     *pass.loop);
+
+  return std::make_pair(verdict,
+                        dispatcher.getProfiles().front().cachedQueries);
+}
+
+std::string DADTestSuite::getName(MemoryDataDependenceStrength verdict) {
+  switch (verdict) {
+    case CANNOT_EXIST:
+      return "CANNOT_EXIST";
+    case MUST_EXIST:
+      return "MUST_EXIST";
+    default:
+      return "MAY_EXIST";
+  }
+}
+
+Values DADTestSuite::independenceWinsOverMustDependence(ModulePass &pass,
+                                                        TestSuite &suite) {
+  auto &dadPass = static_cast<DADTestSuite &>(pass);
+  Values values;
+
+  /*
+   * A proof that the dependence does not exist wins regardless of the order
+   * of the analyses.
+   */
+  auto verdicts = DADTestSuite::dispatch(dadPass, { MUST_EXIST, CANNOT_EXIST });
+  values.insert("Must then cannot, function: "
+                + DADTestSuite::getName(verdicts.first));
+  values.insert("Must then cannot, loop: "
+                + DADTestSuite::getName(verdicts.second));
+  verdicts = DADTestSuite::dispatch(dadPass, { CANNOT_EXIST, MUST_EXIST });
+  values.insert("Cannot then must, function: "
+                + DADTestSuite::getName(verdicts.first));
+  values.insert("Cannot then must, loop: "
+                + DADTestSuite::getName(verdicts.second));
+
+  return values;
+}
+
+Values DADTestSuite::mustDependenceWinsOverMayDependence(ModulePass &pass,
+                                                         TestSuite &suite) {
+  auto &dadPass = static_cast<DADTestSuite &>(pass);
+  Values values;
+
+  auto verdicts = DADTestSuite::dispatch(dadPass, { MAY_EXIST, MUST_EXIST });
+  values.insert("May then must, function: "
+                + DADTestSuite::getName(verdicts.first));
+  values.insert("May then must, loop: "
+                + DADTestSuite::getName(verdicts.second));
+  verdicts = DADTestSuite::dispatch(dadPass, { MAY_EXIST, MAY_EXIST });
+  values.insert("May only, function: " + DADTestSuite::getName(verdicts.first));
+  values.insert("May only, loop: " + DADTestSuite::getName(verdicts.second));
+
+  return values;
+}
+
+Values DADTestSuite::analysesAreInvokedInInsertionOrder(ModulePass &pass,
+                                                        TestSuite &suite) {
+  auto &dadPass = static_cast<DADTestSuite &>(pass);
+  Values values;
+
+  /*
+   * Add the analyses so that the order of their addresses does not match the
+   * order they are added.
+   */
+  std::vector<std::string> invocations;
+  auto third = new FixedVerdictAnalysis("third", MAY_EXIST, invocations);
+  auto second = new FixedVerdictAnalysis("second", MAY_EXIST, invocations);
+  auto first = new FixedVerdictAnalysis("first", MAY_EXIST, invocations);
+  DependenceAnalysisDispatcher dispatcher;
+  dispatcher.addAnalysis(first);
+  dispatcher.addAnalysis(second);
+  dispatcher.addAnalysis(third);
+  dispatcher.addAnalysis(first);
+
+  dispatcher.isThereThisMemoryDataDependenceType(DG_DATA_RAW,
+                                                 dadPass.store,
+                                                 dadPass.load,
+                                                 *dadPass.loop);
+  std::string order;
+  for (auto &name : invocations) {
+    order += (order.empty() ? "" : " ") + name;
+  }
+  values.insert("Invocation order: " + order);
+
+  std::string profiles;
+  for (auto &profile : dispatcher.getProfiles()) {
+    profiles += (profiles.empty() ? "" : " ") + profile.name;
+  }
+  values.insert("Profiles: " + profiles);
+
+  delete first;
+  delete second;
+  delete third;
+
+  return values;
+}
+
+Values DADTestSuite::intraproceduralVerdictsAreCached(ModulePass &pass,
+                                                      TestSuite &suite) {
+  auto &dadPass = static_cast<DADTestSuite &>(pass);
+  Values values;
+
+  /*
+   * The verdict of the first query is reused.
+   */
+  auto result = DADTestSuite::queryTwice(dadPass, true, dadPass.load);
+  values.insert("Second verdict: " + DADTestSuite::getName(result.first));
+  values.insert("Cached queries: " + std::to_string(result.second));
+
+  return values;
+}
+
+Values DADTestSuite::otherVerdictsAreNotCached(ModulePass &pass,
+                                               TestSuite &suite) {
+  auto &dadPass = static_cast<DADTestSuite &>(pass);
+  Values values;
+
+  /*
+   * The analysis can look at other functions, which can change without
+   * changing the function of the loop.
+   */
+  auto result = DADTestSuite::queryTwice(dadPass, false, dadPass.load);
+  values.insert("Second verdict: " + DADTestSuite::getName(result.first));
+  values.insert("Cached queries: " + std::to_string(result.second));
+
+  return values;
+}
+
+Values DADTestSuite::verdictsAboutCallsAreNotCached(ModulePass &pass,
+                                                    TestSuite &suite) {
+  auto &dadPass = static_cast<DADTestSuite &>(pass);
+  Values values;
+
+  /*
+   * Verdicts about calls depend on the callees even for intraprocedural
+   * analyses.
+   */
+  auto result = DADTestSuite::queryTwice(dadPass, true, dadPass.call);
+  values.insert("Second verdict: " + DADTestSuite::getName(result.first));
+  values.insert("Cached queries: " + std::to_string(result.second));
+
+  return values;
+}
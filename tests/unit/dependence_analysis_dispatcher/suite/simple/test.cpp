@@ -0,0 +1,12 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+int main(int argc, char *argv[]) {
+  int a[100];
+  a[0] = argc;
+  for (int i = 1; i < argc; ++i) {
+    a[i] = a[i - 1] + i;
+    printf("%d\n", a[i]);
+  }
+  return 0;
+}
@@ -57,6 +57,13 @@ public:
 
 private:
   static Values domTreesAreIdentical(ModulePass &pass, TestSuite &suite);
+  static Values blocksDominanceIsCorrect(ModulePass &pass, TestSuite &suite);
+  static Values instructionsDominanceIsCorrect(ModulePass &pass,
+                                               TestSuite &suite);
+  static Values unreachableBlocksAreNotInTrees(ModulePass &pass,
+                                               TestSuite &suite);
+
+  static std::string blockToString(BasicBlock *bb);
 
   static Values domNodeIsIdentical(DSTestSuite &pass,
                                    DomTreeNodeBase<BasicBlock> &node,
@@ -48,9 +48,15 @@ static RegisterStandardPasses _RegPass2(
 
 const char *DSTestSuite::tests[] = {
   "dom trees are identical",
+  "dominance between basic blocks",
+  "dominance between instructions",
+  "unreachable basic blocks",
 };
 TestFunction DSTestSuite::testFns[] = {
   DSTestSuite::domTreesAreIdentical,
+  DSTestSuite::blocksDominanceIsCorrect,
+  DSTestSuite::instructionsDominanceIsCorrect,
+  DSTestSuite::unreachableBlocksAreNotInTrees,
 };
 
 bool DSTestSuite::doInitialization(Module &M) {
@@ -152,3 +158,172 @@ Values DSTestSuite::domTreesAreIdentical(ModulePass &pass, TestSuite &suite) {
     return errors;
   return {};
 }
+
+std::string DSTestSuite::blockToString(BasicBlock *bb) {
+  std::string s;
+  raw_string_ostream stream(s);
+  bb->printAsOperand(stream, false);
+  return stream.str();
+}
+
+Values DSTestSuite::blocksDominanceIsCorrect(ModulePass &pass,
+                                             TestSuite &suite) {
+  auto &dsPass = static_cast<DSTestSuite &>(pass);
+  auto &DT = dsPass.ds->DT;
+  auto &PDT = dsPass.ds->PDT;
+  auto F = dsPass.dt->getRoot()->getParent();
+
+  /*
+   * Compare the answers with the ones of LLVM for every pair of basic blocks
+   * that belong to the trees.
+   */
+  Values errors;
+  for (auto &B1 : *F) {
+    for (auto &B2 : *F) {
+      auto pairName = blockToString(&B1) + " " + blockToString(&B2);
+      if (dsPass.dt->getNode(&B1) && dsPass.dt->getNode(&B2)) {
+        if (DT.dominates(&B1, &B2) != dsPass.dt->dominates(&B1, &B2)) {
+          errors.insert("Wrong dominance: " + pairName);
+        }
+        if (DT.strictlyDominates(&B1, &B2)
+            != dsPass.dt->properlyDominates(&B1, &B2)) {
+          errors.insert("Wrong strict dominance: " + pairName);
+        }
+        if (DT.dominates(DT.getNode(&B1), DT.getNode(&B2))
+            != DT.dominates(&B1, &B2)) {
+          errors.insert("Wrong dominance between nodes: " + pairName);
+        }
+      }
+      if (dsPass.pdt->getNode(&B1) && dsPass.pdt->getNode(&B2)) {
+        if (PDT.dominates(&B1, &B2) != dsPass.pdt->dominates(&B1, &B2)) {
+          errors.insert("Wrong post-dominance: " + pairName);
+        }
+        if (PDT.strictlyDominates(&B1, &B2)
+            != dsPass.pdt->properlyDominates(&B1, &B2)) {
+          errors.insert("Wrong strict post-dominance: " + pairName);
+        }
+        if (PDT.dominates(PDT.getNode(&B1), PDT.getNode(&B2))
+            != PDT.dominates(&B1, &B2)) {
+          errors.insert("Wrong post-dominance between nodes: " + pairName);
+        }
+      }
+    }
+  }
+
+  return errors;
+}
+
+Values DSTestSuite::instructionsDominanceIsCorrect(ModulePass &pass,
+                                                   TestSuite &suite) {
+  auto &dsPass = static_cast<DSTestSuite &>(pass);
+  auto &DT = dsPass.ds->DT;
+  auto &PDT = dsPass.ds->PDT;
+  auto F = dsPass.dt->getRoot()->getParent();
+
+  Values errors;
+  for (auto &B : *F) {
+    if (!dsPass.dt->getNode(&B) || !dsPass.pdt->getNode(&B)) {
+      continue;
+    }
+
+    /*
+     * An instruction dominates itself, but it does not strictly dominate
+     * itself.
+     * As for the original implementation, an instruction does not
+     * post-dominate itself.
+     */
+    for (auto &I : B) {
+      auto name = suite.valueToString(&I);
+      if (!DT.dominates(&I, &I)) {
+        errors.insert("Instruction does not dominate itself: " + name);
+      }
+      if (DT.strictlyDominates(&I, &I)) {
+        errors.insert("Instruction strictly dominates itself: " + name);
+      }
+      if (PDT.dominates(&I, &I)) {
+        errors.insert("Instruction post-dominates itself: " + name);
+      }
+    }
+
+    /*
+     * Instructions of the same basic block, in both orders.
+     */
+    for (auto &I : B) {
+      for (auto &J : B) {
+        if (&I == &J) {
+          continue;
+        }
+        auto pairName =
+            suite.valueToString(&I) + " ; " + suite.valueToString(&J);
+        auto isIBeforeJ = I.comesBefore(&J);
+        if (DT.dominates(&I, &J) != isIBeforeJ) {
+          errors.insert("Wrong dominance in the same block: " + pairName);
+        }
+        if (DT.strictlyDominates(&I, &J) != isIBeforeJ) {
+          errors.insert("Wrong strict dominance in the same block: "
+                        + pairName);
+        }
+        if (PDT.dominates(&I, &J) == isIBeforeJ) {
+          errors.insert("Wrong post-dominance in the same block: " + pairName);
+        }
+      }
+    }
+  }
+
+  /*
+   * Instructions of different basic blocks follow their basic blocks.
+   */
+  for (auto &B1 : *F) {
+    for (auto &B2 : *F) {
+      if ((&B1 == &B2) || !dsPass.dt->getNode(&B1)
+          || !dsPass.dt->getNode(&B2)) {
+        continue;
+      }
+      auto I = B1.getTerminator();
+      auto J = &*B2.begin();
+      auto pairName = suite.valueToString(I) + " ; " + suite.valueToString(J);
+      if (DT.dominates(I, J) != dsPass.dt->dominates(&B1, &B2)) {
+        errors.insert("Wrong dominance across blocks: " + pairName);
+      }
+      if (!dsPass.pdt->getNode(&B1) || !dsPass.pdt->getNode(&B2)) {
+        continue;
+      }
+      if (PDT.dominates(I, J) != dsPass.pdt->dominates(&B1, &B2)) {
+        errors.insert("Wrong post-dominance across blocks: " + pairName);
+      }
+    }
+  }
+
+  return errors;
+}
+
+Values DSTestSuite::unreachableBlocksAreNotInTrees(ModulePass &pass,
+                                                   TestSuite &suite) {
+  auto &dsPass = static_cast<DSTestSuite &>(pass);
+  auto F = dsPass.dt->getRoot()->getParent();
+
+  /*
+   * Basic blocks that are not reachable from the entry have no node in the
+   * dominator tree: the summary must not have one either.
+   * The number of unreachable basic blocks is returned.
+   */
+  Values values;
+  auto unreachableBlocks = 0u;
+  for (auto &B : *F) {
+    if ((dsPass.ds->DT.getNode(&B) == nullptr)
+        != (dsPass.dt->getNode(&B) == nullptr)) {
+      values.insert("Wrong dominator node: " + blockToString(&B));
+    }
+    if ((dsPass.ds->PDT.getNode(&B) == nullptr)
+        != (dsPass.pdt->getNode(&B) == nullptr)) {
+      values.insert("Wrong post-dominator node: " + blockToString(&B));
+    }
+    if (dsPass.dt->getNode(&B) == nullptr) {
+      unreachableBlocks++;
+    }
+  }
+  values.insert("Unreachable basic blocks: "
+                + std::to_string(unreachableBlocks));
+
+  return values;
+}
@@ -0,0 +1,24 @@
+#include <stdio.h>
+#include <stdint.h>
+
+int main (int argc, char *argv[]){
+  int v1 = argc;
+
+  goto loop;
+
+  // No branch reaches this block.
+unreachable:
+  v1 = v1 * 7;
+
+loop:
+  for (uint32_t i = 0; i < 100; ++i) {
+    if (v1 > 50) {
+      v1 = v1 - 3;
+    } else {
+      v1 = v1 + 2;
+    }
+  }
+
+  printf("%d\n", v1);
+  return 0;
+}
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/UnitTestHelpers.dir/src/Comparators.cpp.o"
+  "CMakeFiles/UnitTestHelpers.dir/src/Comparators.cpp.o.d"
+  "CMakeFiles/UnitTestHelpers.dir/src/TestSuite.cpp.o"
+  "CMakeFiles/UnitTestHelpers.dir/src/TestSuite.cpp.o.d"
+  "UnitTestHelpers.pdb"
+  "UnitTestHelpers.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/UnitTestHelpers.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../hot_profile_cache.pdb"
+  "../hot_profile_cache.so"
+  "CMakeFiles/hot_profile_cache.dir/HPCTestSuite.cpp.o"
+  "CMakeFiles/hot_profile_cache.dir/HPCTestSuite.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hot_profile_cache.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/install-hot_profile_cache-stripped"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/install-hot_profile_cache-stripped.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
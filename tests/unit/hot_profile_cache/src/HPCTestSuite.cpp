@@ -0,0 +1,283 @@
+/*
+ * Copyright 2016 - 2024  Angelo Matni, Simone Campanoni
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "HPCTestSuite.hpp"
+
+using namespace llvm;
+using namespace arcana::noelle;
+
+// Register pass to "opt"
+char HPCTestSuite::ID = 0;
+static RegisterPass<HPCTestSuite> X("UnitTester",
+                                    "Hot Profile Cache Unit Tester");
+
+// Register pass to "clang"
+static HPCTestSuite *_PassMaker = NULL;
+static RegisterStandardPasses _RegPass1(PassManagerBuilder::EP_OptimizerLast,
+                                        [](const PassManagerBuilder &,
+                                           legacy::PassManagerBase &PM) {
+                                          if (!_PassMaker) {
+                                            PM.add(_PassMaker =
+                                                       new HPCTestSuite());
+                                          }
+                                        }); // ** for -Ox
+static RegisterStandardPasses _RegPass2(
+    PassManagerBuilder::EP_EnabledOnOptLevel0,
+    [](const PassManagerBuilder &, legacy::PassManagerBase &PM) {
+      if (!_PassMaker) {
+        PM.add(_PassMaker = new HPCTestSuite());
+      }
+    }); // ** for -O0
+
+const char *HPCTestSuite::tests[] = {
+  "cache round trips",
+  "stale entries are rejected",
+  "missing cache is invalid",
+};
+TestFunction HPCTestSuite::testFns[] = {
+  HPCTestSuite::cacheRoundTrips,
+  HPCTestSuite::staleEntriesAreRejected,
+  HPCTestSuite::missingCacheIsInvalid,
+};
+
+bool HPCTestSuite::doInitialization(Module &M) {
+  errs() << "HPCTestSuite: Initialize\n";
+  const int numTests = sizeof(tests) / sizeof(tests[0]);
+  this->suite =
+      new TestSuite("HPCTestSuite", tests, testFns, numTests, "test.txt");
+  this->M = &M;
+  return false;
+}
+
+void HPCTestSuite::getAnalysisUsage(AnalysisUsage &AU) const {
+  AU.setPreservesAll();
+}
+
+bool HPCTestSuite::runOnModule(Module &M) {
+  errs() << "HPCTestSuite: Start\n";
+
+  suite->runTests((ModulePass &)*this);
+
+  return false;
+}
+
+/*
+ * The invocations stored for the basic block @bbIndex of the function
+ * @functionIndex.
+ */
+static uint64_t invocationsOf(uint64_t functionIndex, uint64_t bbIndex) {
+  return ((functionIndex + 1) * 1000) + bbIndex;
+}
+
+bool HPCTestSuite::writeCache(Module &M, std::string &fileName) {
+
+  /*
+   * Assign distinct invocations to every basic block of the module.
+   */
+  std::unordered_map<BasicBlock *, uint64_t> bbInvocations;
+  uint64_t functionIndex = 0;
+  for (auto &F : M) {
+    uint64_t bbIndex = 0;
+    for (auto &bb : F) {
+      bbInvocations[&bb] = invocationsOf(functionIndex, bbIndex);
+      bbIndex++;
+    }
+    functionIndex++;
+  }
+
+  /*
+   * Write the cache.
+   */
+  SmallString<128> path;
+  if (sys::fs::createTemporaryFile("hot_profile_cache", "bin", path)) {
+    return false;
+  }
+  fileName = path.str().str();
+
+  return HotProfileCache::write(M, bbInvocations, fileName);
+}
+
+std::vector<Function *> HPCTestSuite::restoredFunctions(
+    Module &M,
+    HotProfileCache &cache) {
+  std::vector<Function *> restored;
+
+  uint64_t functionIndex = 0;
+  for (auto &F : M) {
+    auto currentFunctionIndex = functionIndex;
+    functionIndex++;
+    if (F.empty()) {
+      continue;
+    }
+
+    /*
+     * Fetch the invocations stored for @F and check they are the ones written.
+     */
+    std::vector<uint64_t> invocations;
+    if (!cache.getBasicBlockInvocations(F, invocations)) {
+      continue;
+    }
+    if (invocations.size() != F.size()) {
+      continue;
+    }
+    auto isCorrect = true;
+    for (auto bbIndex = 0u; bbIndex < invocations.size(); bbIndex++) {
+      if (invocations[bbIndex]
+          != invocationsOf(currentFunctionIndex, bbIndex)) {
+        isCorrect = false;
+        break;
+      }
+    }
+    if (!isCorrect) {
+      continue;
+    }
+    restored.push_back(&F);
+  }
+
+  return restored;
+}
+
+Values HPCTestSuite::cacheRoundTrips(ModulePass &pass, TestSuite &suite) {
+  auto &M = *static_cast<HPCTestSuite &>(pass).M;
+  Values values;
+
+  /*
+   * Write the cache and load it back.
+   */
+  std::string fileName;
+  if (!HPCTestSuite::writeCache(M, fileName)) {
+    values.insert("Cache not written");
+    return values;
+  }
+  HotProfileCache cache(fileName);
+  if (cache.isValid()) {
+    values.insert("Cache is valid");
+  }
+
+  /*
+   * All functions with a body must be restored.
+   */
+  auto restored = HPCTestSuite::restoredFunctions(M, cache);
+  values.insert("Restored functions: " + std::to_string(restored.size()));
+
+  sys::fs::remove(fileName);
+
+  return values;
+}
+
+Values HPCTestSuite::staleEntriesAreRejected(ModulePass &pass,
+                                             TestSuite &suite) {
+  auto &M = *static_cast<HPCTestSuite &>(pass).M;
+  auto mainF = M.getFunction("main");
+  Values values;
+
+  /*
+   * Write the cache.
+   */
+  std::string fileName;
+  if (!HPCTestSuite::writeCache(M, fileName)) {
+    values.insert("Cache not written");
+    return values;
+  }
+
+  /*
+   * Change the hash of main by changing its entry count.
+   */
+  auto originalProfile = mainF->getMetadata(LLVMContext::MD_prof);
+  auto entryCount = mainF->getEntryCount();
+  mainF->setEntryCount(entryCount.hasValue() ? (entryCount->getCount() + 1)
+                                             : 1);
+
+  /*
+   * The section of main must be rejected, the others must still be restored.
+   */
+  {
+    HotProfileCache cache(fileName);
+    auto restored = HPCTestSuite::restoredFunctions(M, cache);
+    values.insert("Restored functions with main changed: "
+                  + std::to_string(restored.size()));
+    if (std::find(restored.begin(), restored.end(), mainF) == restored.end()) {
+      values.insert("main is stale");
+    }
+  }
+
+  /*
+   * Revert the change: the section of main must be restored again.
+   */
+  mainF->setMetadata(LLVMContext::MD_prof, originalProfile);
+  {
+    HotProfileCache cache(fileName);
+    auto restored = HPCTestSuite::restoredFunctions(M, cache);
+    values.insert("Restored functions with main reverted: "
+                  + std::to_string(restored.size()));
+  }
+
+  sys::fs::remove(fileName);
+
+  return values;
+}
+
+Values HPCTestSuite::missingCacheIsInvalid(ModulePass &pass,
+                                           TestSuite &suite) {
+  auto &M = *static_cast<HPCTestSuite &>(pass).M;
+  auto mainF = M.getFunction("main");
+  Values values;
+
+  /*
+   * A file that does not exist.
+   */
+  SmallString<128> path;
+  if (sys::fs::createTemporaryFile("hot_profile_cache", "bin", path)) {
+    values.insert("Temporary file not created");
+    return values;
+  }
+  std::string fileName = path.str().str();
+  sys::fs::remove(fileName);
+  {
+    HotProfileCache cache(fileName);
+    std::vector<uint64_t> invocations;
+    if (!cache.isValid()
+        && !cache.getBasicBlockInvocations(*mainF, invocations)) {
+      values.insert("Missing cache is invalid");
+    }
+  }
+
+  /*
+   * A file that is not a cache.
+   */
+  {
+    std::error_code ec;
+    raw_fd_ostream file(fileName, ec, sys::fs::OF_None);
+    file << "not a profile cache";
+  }
+  {
+    HotProfileCache cache(fileName);
+    std::vector<uint64_t> invocations;
+    if (!cache.isValid()
+        && !cache.getBasicBlockInvocations(*mainF, invocations)) {
+      values.insert("Malformed cache is invalid");
+    }
+  }
+
+  sys::fs::remove(fileName);
+
+  return values;
+}
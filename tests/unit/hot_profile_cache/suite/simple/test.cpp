@@ -0,0 +1,32 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+int sum (int n){
+  int s = 0;
+  for (int i = 0; i < n; ++i) {
+    s += i;
+  }
+  return s;
+}
+
+int product (int n){
+  int p = 1;
+  for (int i = 1; i < n; ++i) {
+    if (i % 2) {
+      p *= i;
+    } else {
+      p += i;
+    }
+  }
+  return p;
+}
+
+int main (int argc, char *argv[]){
+  if (argc < 2) {
+    return 0;
+  }
+  auto n = atoi(argv[1]);
+
+  printf("%d, %d\n", sum(n), product(n));
+  return 0;
+}
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/install-pdg_sidecar"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/install-pdg_sidecar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
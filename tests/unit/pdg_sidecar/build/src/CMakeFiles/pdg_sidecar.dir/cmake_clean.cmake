@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../pdg_sidecar.pdb"
+  "../pdg_sidecar.so"
+  "CMakeFiles/pdg_sidecar.dir/PSTestSuite.cpp.o"
+  "CMakeFiles/pdg_sidecar.dir/PSTestSuite.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/pdg_sidecar.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
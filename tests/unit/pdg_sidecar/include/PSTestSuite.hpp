@@ -0,0 +1,96 @@
+/*
+ * Copyright 2016 - 2024  Angelo Matni, Simone Campanoni
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#pragma once
+
+#include "llvm/Pass.h"
+#include "llvm/IR/Function.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm/IR/InstIterator.h"
+#include "llvm/Support/FileSystem.h"
+
+#include "TestSuite.hpp"
+#include "arcana/noelle/core/NoellePass.hpp"
+#include "arcana/noelle/core/PDGSidecar.hpp"
+
+#include <sstream>
+#include <vector>
+#include <string>
+#include <map>
+
+using namespace parallelizertests;
+using namespace arcana::noelle;
+
+namespace llvm {
+
+class PSTestSuite : public ModulePass {
+public:
+  PSTestSuite() : ModulePass{ ID } {}
+
+  /*
+   * Class fields
+   */
+  static char ID;
+  static const char *tests[];
+  static parallelizertests::TestFunction testFns[];
+
+  bool doInitialization(Module &M) override;
+  bool runOnModule(Module &M) override;
+  void getAnalysisUsage(AnalysisUsage &AU) const override;
+
+private:
+  static Values sidecarRoundTrips(ModulePass &pass, TestSuite &suite);
+  static Values pdgRoundTrips(ModulePass &pass, TestSuite &suite);
+  static Values loopDependencesRoundTrip(ModulePass &pass, TestSuite &suite);
+  static Values changedStructLayoutIsRecomputed(ModulePass &pass,
+                                                TestSuite &suite);
+  static Values changedConfigurationIsNotReused(ModulePass &pass,
+                                                TestSuite &suite);
+
+  /*
+   * Configuration of the PDG generator the sidecar files are written with.
+   */
+  static constexpr uint64_t configurationHash = 0x5eed;
+
+  static bool writeSidecar(Module &M, std::string &fileName);
+
+  static bool writeSidecar(PDG *pdg,
+                           Module &M,
+                           uint64_t configurationHash,
+                           std::string &fileName);
+
+  /*
+   * Description of each dependence of @pdg (kind, data dependence type,
+   * loop-carried flag, and sub-edges) with the number of times it occurs.
+   */
+  static std::map<std::string, uint64_t> describeDependences(PDG *pdg);
+
+  static std::string describeDependence(DGEdge<Value, Value> *edge);
+
+  static std::vector<Function *> upToDateFunctions(
+      Module &M,
+      PDGSidecar &sidecar);
+
+  TestSuite *suite;
+  Module *M;
+  Noelle *noelle;
+};
+} // namespace llvm
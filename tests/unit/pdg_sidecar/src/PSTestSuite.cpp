@@ -0,0 +1,487 @@
+/*
+ * Copyright 2016 - 2024  Angelo Matni, Simone Campanoni
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights to
+ use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies
+ of the Software, and to permit persons to whom the Software is furnished to do
+ so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+ OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "PSTestSuite.hpp"
+
+using namespace llvm;
+using namespace arcana::noelle;
+
+// Register pass to "opt"
+char PSTestSuite::ID = 0;
+static RegisterPass<PSTestSuite> X("UnitTester", "PDG Sidecar Unit Tester");
+
+// Register pass to "clang"
+static PSTestSuite *_PassMaker = NULL;
+static RegisterStandardPasses _RegPass1(PassManagerBuilder::EP_OptimizerLast,
+                                        [](const PassManagerBuilder &,
+                                           legacy::PassManagerBase &PM) {
+                                          if (!_PassMaker) {
+                                            PM.add(_PassMaker =
+                                                       new PSTestSuite());
+                                          }
+                                        }); // ** for -Ox
+static RegisterStandardPasses _RegPass2(
+    PassManagerBuilder::EP_EnabledOnOptLevel0,
+    [](const PassManagerBuilder &, legacy::PassManagerBase &PM) {
+      if (!_PassMaker) {
+        PM.add(_PassMaker = new PSTestSuite());
+      }
+    }); // ** for -O0
+
+const char *PSTestSuite::tests[] = {
+  "sidecar round trips",
+  "PDG round trips",
+  "loop dependences round trip",
+  "changed struct layout is recomputed",
+  "changed configuration is not reused",
+};
+TestFunction PSTestSuite::testFns[] = {
+  PSTestSuite::sidecarRoundTrips,
+  PSTestSuite::pdgRoundTrips,
+  PSTestSuite::loopDependencesRoundTrip,
+  PSTestSuite::changedStructLayoutIsRecomputed,
+  PSTestSuite::changedConfigurationIsNotReused,
+};
+
+bool PSTestSuite::doInitialization(Module &M) {
+  errs() << "PSTestSuite: Initialize\n";
+  const int numTests = sizeof(tests) / sizeof(tests[0]);
+  this->suite =
+      new TestSuite("PSTestSuite", tests, testFns, numTests, "test.txt");
+  this->M = &M;
+  return false;
+}
+
+void PSTestSuite::getAnalysisUsage(AnalysisUsage &AU) const {
+  AU.addRequired<NoellePass>();
+  AU.setPreservesAll();
+}
+
+bool PSTestSuite::runOnModule(Module &M) {
+  errs() << "PSTestSuite: Start\n";
+  this->noelle = &getAnalysis<NoellePass>().getNoelle();
+
+  suite->runTests((ModulePass &)*this);
+
+  return false;
+}
+
+bool PSTestSuite::writeSidecar(Module &M, std::string &fileName) {
+
+  /*
+   * The hashes of the functions do not depend on their dependences, so a PDG
+   * without edges is enough.
+   */
+  PDG pdg(M);
+
+  return PSTestSuite::writeSidecar(&pdg,
+                                   M,
+                                   PSTestSuite::configurationHash,
+                                   fileName);
+}
+
+bool PSTestSuite::writeSidecar(PDG *pdg,
+                               Module &M,
+                               uint64_t configurationHash,
+                               std::string &fileName) {
+  SmallString<128> path;
+  if (sys::fs::createTemporaryFile("pdg_sidecar", "pdg", path)) {
+    return false;
+  }
+  fileName = path.str().str();
+
+  return PDGSidecar::write(pdg, M, configurationHash, fileName);
+}
+
+std::string PSTestSuite::describeDependence(DGEdge<Value, Value> *edge) {
+  std::string description;
+  raw_string_ostream out(description);
+  out << edge->getSrc() << " -> " << edge->getDst() << " kind "
+      << edge->getKind();
+  if (auto dataDep = dyn_cast<DataDependence<Value, Value>>(edge)) {
+    out << " type " << dataDep->getDataDependenceType();
+  }
+  if (edge->isLoopCarriedDependence()) {
+    out << " loop-carried";
+  }
+
+  /*
+   * Sub-edges are not ordered.
+   */
+  std::vector<std::string> subEdges;
+  for (auto subEdge : edge->getSubEdges()) {
+    subEdges.push_back(PSTestSuite::describeDependence(subEdge));
+  }
+  std::sort(subEdges.begin(), subEdges.end());
+  for (auto &subEdge : subEdges) {
+    out << " [" << subEdge << "]";
+  }
+
+  return out.str();
+}
+
+std::map<std::string, uint64_t> PSTestSuite::describeDependences(PDG *pdg) {
+  std::map<std::string, uint64_t> descriptions;
+  for (auto edge : pdg->getEdges()) {
+    descriptions[PSTestSuite::describeDependence(edge)]++;
+  }
+
+  return descriptions;
+}
+
+std::vector<Function *> PSTestSuite::upToDateFunctions(Module &M,
+                                                       PDGSidecar &sidecar) {
+  std::vector<Function *> upToDate;
+  for (auto &F : M) {
+    if (F.empty()) {
+      continue;
+    }
+    if (sidecar.hasUpToDateDependences(F)) {
+      upToDate.push_back(&F);
+    }
+  }
+
+  return upToDate;
+}
+
+Values PSTestSuite::sidecarRoundTrips(ModulePass &pass, TestSuite &suite) {
+  auto &M = *static_cast<PSTestSuite &>(pass).M;
+  Values values;
+
+  /*
+   * Write the sidecar and load it back.
+   */
+  std::string fileName;
+  if (!PSTestSuite::writeSidecar(M, fileName)) {
+    values.insert("Sidecar not written");
+    return values;
+  }
+  PDGSidecar sidecar(fileName);
+  if (sidecar.isValid()) {
+    values.insert("Sidecar is valid");
+  }
+
+  /*
+   * All functions with a body must be reusable.
+   */
+  auto upToDate = PSTestSuite::upToDateFunctions(M, sidecar);
+  values.insert("Up-to-date functions: " + std::to_string(upToDate.size()));
+
+  sys::fs::remove(fileName);
+
+  return values;
+}
+
+Values PSTestSuite::pdgRoundTrips(ModulePass &pass, TestSuite &suite) {
+  auto &psPass = static_cast<PSTestSuite &>(pass);
+  auto &M = *psPass.M;
+  auto &pdgGenerator = psPass.noelle->getPDGGenerator();
+  auto pdg = pdgGenerator.getPDG();
+  auto configurationHash = pdgGenerator.computeConfigurationHash();
+  Values values;
+
+  /*
+   * Check the PDG exercises every encoding of the sidecar.
+   */
+  std::unordered_map<Value *, uint64_t> nodeIDs;
+  for (auto &F : M) {
+    uint64_t nodeID = 0;
+    for (auto &arg : F.args()) {
+      nodeIDs[&arg] = nodeID++;
+    }
+    for (auto &inst : instructions(F)) {
+      nodeIDs[&inst] = nodeID++;
+    }
+  }
+  for (auto edge : pdg->getEdges()) {
+    if (isa<ControlDependence<Value, Value>>(edge)) {
+      values.insert("PDG has control dependences");
+    } else if (isa<MustMemoryDependence<Value, Value>>(edge)) {
+      values.insert("PDG has must memory dependences");
+    } else if (isa<MayMemoryDependence<Value, Value>>(edge)) {
+      values.insert("PDG has may memory dependences");
+    } else {
+      values.insert("PDG has variable dependences");
+    }
+    if (std::max(nodeIDs[edge->getSrc()], nodeIDs[edge->getDst()]) > 127) {
+      values.insert("PDG has node IDs that do not fit in a byte");
+    }
+    if (auto memDep = dyn_cast<MemoryDependence<Value, Value>>(edge)) {
+      switch (memDep->getDataDependenceType()) {
+        case DG_DATA_RAW:
+          values.insert("PDG has RAW memory dependences");
+          break;
+        case DG_DATA_WAR:
+          values.insert("PDG has WAR memory dependences");
+          break;
+        case DG_DATA_WAW:
+          values.insert("PDG has WAW memory dependences");
+          break;
+      }
+    }
+  }
+
+  /*
+   * Write the PDG.
+   */
+  std::string fileName;
+  if (!PSTestSuite::writeSidecar(pdg, M, configurationHash, fileName)) {
+    values.insert("Sidecar not written");
+    return values;
+  }
+  auto dependences = PSTestSuite::describeDependences(pdg);
+
+  /*
+   * Load the whole PDG.
+   */
+  PDGSidecar sidecar(fileName);
+  auto loadedPDG = sidecar.loadPDG(M, configurationHash);
+  if (loadedPDG == nullptr) {
+    values.insert("PDG not loaded");
+  } else {
+    if (PSTestSuite::describeDependences(loadedPDG) == dependences) {
+      values.insert("Loaded PDG has the same dependences");
+    }
+    delete loadedPDG;
+  }
+
+  /*
+   * Load the dependences one function at a time.
+   */
+  PDG functionsPDG(M);
+  auto allAdded = true;
+  for (auto &F : M) {
+    if (F.empty()) {
+      continue;
+    }
+    allAdded &= sidecar.addDependences(&functionsPDG, F);
+  }
+  if (allAdded
+      && (PSTestSuite::describeDependences(&functionsPDG) == dependences)) {
+    values.insert("PDG loaded per function has the same dependences");
+  }
+
+  sys::fs::remove(fileName);
+
+  return values;
+}
+
+Values PSTestSuite::loopDependencesRoundTrip(ModulePass &pass,
+                                             TestSuite &suite) {
+  auto &psPass = static_cast<PSTestSuite &>(pass);
+  auto &M = *psPass.M;
+  auto &noelle = *psPass.noelle;
+  auto prefixSum = M.getFunction("prefixSum");
+  Values values;
+  if (prefixSum == nullptr) {
+    values.insert("prefixSum not found");
+    return values;
+  }
+  auto loops = noelle.getLoopContents(prefixSum);
+  if (loops->size() != 1) {
+    values.insert("prefixSum does not have one loop");
+    return values;
+  }
+
+  /*
+   * The dependences of the loop are loop-carried or not.
+   * Copy them so sub-edges can be attached without changing the loop.
+   */
+  auto loopDG = loops->front()->getLoopDG()->clone(true);
+  for (auto edge : loopDG->getEdges()) {
+    if (edge->isLoopCarriedDependence()) {
+      values.insert("Loop has loop-carried dependences");
+      break;
+    }
+  }
+
+  /*
+   * Attach sub-edges of every kind to the memory dependences.
+   */
+  std::vector<DGEdge<Value, Value> *> subEdges;
+  for (auto edge : loopDG->getEdges()) {
+    if (!isa<MemoryDependence<Value, Value>>(edge)) {
+      continue;
+    }
+    auto src = edge->getSrcNode();
+    auto dst = edge->getDstNode();
+    auto mustDep =
+        new MustMemoryDependence<Value, Value>(src, dst, DG_DATA_WAW);
+    mustDep->setLoopCarried(true);
+    subEdges.push_back(mustDep);
+    subEdges.push_back(
+        new MayMemoryDependence<Value, Value>(src, dst, DG_DATA_WAR));
+    subEdges.push_back(
+        new VariableDependence<Value, Value>(src, dst, DG_DATA_RAW));
+    subEdges.push_back(new ControlDependence<Value, Value>(src, dst));
+    for (auto i = subEdges.size() - 4; i < subEdges.size(); i++) {
+      edge->addSubEdge(subEdges[i]);
+    }
+  }
+  if (subEdges.size() > 0) {
+    values.insert("Loop has dependences with sub-edges");
+  }
+
+  /*
+   * Write the dependences of the loop and load them back.
+   */
+  std::string fileName;
+  auto configurationHash = noelle.getPDGGenerator().computeConfigurationHash();
+  if (!PSTestSuite::writeSidecar(loopDG, M, configurationHash, fileName)) {
+    values.insert("Sidecar not written");
+    return values;
+  }
+  PDGSidecar sidecar(fileName);
+  auto loadedPDG = sidecar.loadPDG(M, configurationHash);
+  if (loadedPDG == nullptr) {
+    values.insert("PDG not loaded");
+  } else {
+    if (PSTestSuite::describeDependences(loadedPDG)
+        == PSTestSuite::describeDependences(loopDG)) {
+      values.insert("Loaded PDG has the same loop dependences");
+    }
+    delete loadedPDG;
+  }
+
+  sys::fs::remove(fileName);
+  for (auto subEdge : subEdges) {
+    delete subEdge;
+  }
+  delete loopDG;
+
+  return values;
+}
+
+Values PSTestSuite::changedStructLayoutIsRecomputed(ModulePass &pass,
+                                                    TestSuite &suite) {
+  auto &M = *static_cast<PSTestSuite &>(pass).M;
+  auto readB = M.getFunction("readB");
+  auto readReorderedB = M.getFunction("readReorderedB");
+  Values values;
+  if ((readB == nullptr) || (readReorderedB == nullptr)) {
+    values.insert("readB or readReorderedB not found");
+    return values;
+  }
+  GetElementPtrInst *gep = nullptr;
+  for (auto &inst : instructions(*readB)) {
+    if (auto g = dyn_cast<GetElementPtrInst>(&inst)) {
+      gep = g;
+      break;
+    }
+  }
+  if (gep == nullptr) {
+    values.insert("GEP of readB not found");
+    return values;
+  }
+
+  /*
+   * Write the sidecar.
+   */
+  std::string fileName;
+  if (!PSTestSuite::writeSidecar(M, fileName)) {
+    values.insert("Sidecar not written");
+    return values;
+  }
+
+  /*
+   * Make readB access the struct with the 64-bit field first, which has the
+   * same size.
+   * The GEP keeps its indices and the type of its result, but it now
+   * addresses a different offset: the dependences of readB must be
+   * recomputed.
+   */
+  auto recordArg = readB->getArg(0);
+  auto recordPtrType = recordArg->getType();
+  auto recordType = gep->getSourceElementType();
+  auto reorderedPtrType = readReorderedB->getArg(0)->getType();
+  auto reorderedType =
+      cast<PointerType>(reorderedPtrType)->getNonOpaquePointerElementType();
+  recordArg->mutateType(reorderedPtrType);
+  gep->setSourceElementType(reorderedType);
+  {
+    PDGSidecar sidecar(fileName);
+    auto upToDate = PSTestSuite::upToDateFunctions(M, sidecar);
+    values.insert("Up-to-date functions with the layout changed: "
+                  + std::to_string(upToDate.size()));
+    if (std::find(upToDate.begin(), upToDate.end(), readB) == upToDate.end()) {
+      values.insert("readB is stale");
+    }
+  }
+
+  /*
+   * Revert the change: readB must be reusable again.
+   */
+  recordArg->mutateType(recordPtrType);
+  gep->setSourceElementType(recordType);
+  {
+    PDGSidecar sidecar(fileName);
+    auto upToDate = PSTestSuite::upToDateFunctions(M, sidecar);
+    values.insert("Up-to-date functions with the layout reverted: "
+                  + std::to_string(upToDate.size()));
+  }
+
+  sys::fs::remove(fileName);
+
+  return values;
+}
+
+Values PSTestSuite::changedConfigurationIsNotReused(ModulePass &pass,
+                                                    TestSuite &suite) {
+  auto &M = *static_cast<PSTestSuite &>(pass).M;
+  Values values;
+
+  /*
+   * Write the sidecar.
+   */
+  std::string fileName;
+  if (!PSTestSuite::writeSidecar(M, fileName)) {
+    values.insert("Sidecar not written");
+    return values;
+  }
+
+  /*
+   * The PDG can be loaded only with the configuration it has been computed
+   * with.
+   */
+  PDGSidecar sidecar(fileName);
+  auto otherConfigurationHash = PSTestSuite::configurationHash + 1;
+  if (sidecar.hasTheSameConfiguration(PSTestSuite::configurationHash)) {
+    values.insert("Same configuration is accepted");
+  }
+  if (!sidecar.hasTheSameConfiguration(otherConfigurationHash)) {
+    values.insert("Other configuration is rejected");
+  }
+  auto pdg = sidecar.loadPDG(M, PSTestSuite::configurationHash);
+  if (pdg != nullptr) {
+    values.insert("PDG loaded with the same configuration");
+    delete pdg;
+  }
+  pdg = sidecar.loadPDG(M, otherConfigurationHash);
+  if (pdg == nullptr) {
+    values.insert("PDG not loaded with another configuration");
+  } else {
+    delete pdg;
+  }
+
+  sys::fs::remove(fileName);
+
+  return values;
+}
@@ -0,0 +1,82 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+struct Record {
+  int a;
+  int b;
+  long c;
+};
+
+struct Reordered {
+  long c;
+  int a;
+  int b;
+};
+
+extern "C" int readB(struct Record *r) {
+  return r->b;
+}
+
+extern "C" int readReorderedB(struct Reordered *r) {
+  return r->b;
+}
+
+/*
+ * Loop-carried dependences through memory.
+ */
+extern "C" void prefixSum(int *a, int n) {
+  for (int i = 1; i < n; ++i) {
+    a[i] = a[i - 1] + a[i];
+  }
+}
+
+/*
+ * More than 128 instructions, so the IDs of the nodes do not fit in a byte.
+ */
+extern "C" int chain(int *a) {
+  a[0] = 1;
+  int x = a[0];
+  a[1] = a[0] * 3 + x;
+  a[2] = a[1] * 4 + x;
+  a[3] = a[2] * 5 + x;
+  a[4] = a[3] * 6 + x;
+  a[5] = a[4] * 7 + x;
+  a[6] = a[5] * 8 + x;
+  a[7] = a[6] * 9 + x;
+  a[8] = a[7] * 10 + x;
+  a[9] = a[8] * 11 + x;
+  a[10] = a[9] * 12 + x;
+  a[11] = a[10] * 13 + x;
+  a[12] = a[11] * 14 + x;
+  a[13] = a[12] * 15 + x;
+  a[14] = a[13] * 16 + x;
+  a[15] = a[14] * 17 + x;
+  a[16] = a[15] * 18 + x;
+  a[17] = a[16] * 19 + x;
+  a[18] = a[17] * 20 + x;
+  a[19] = a[18] * 21 + x;
+  a[20] = a[19] * 22 + x;
+  a[21] = a[20] * 23 + x;
+  a[22] = a[21] * 24 + x;
+  a[23] = a[22] * 25 + x;
+  a[24] = a[23] * 26 + x;
+  return a[24];
+}
+
+int sum(int n) {
+  int s = 0;
+  for (int i = 0; i < n; ++i) {
+    s += i;
+  }
+  return s;
+}
+
+int main(int argc, char *argv[]) {
+  if (argc < 2) {
+    return 0;
+  }
+  auto n = atoi(argv[1]);
+
+  printf("%d\n", sum(n));
+  return 0;
+}
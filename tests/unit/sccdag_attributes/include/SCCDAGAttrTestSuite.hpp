@@ -79,6 +79,13 @@ private:
 
   static Values loopCarriedDependencies(ModulePass &pass, TestSuite &suite);
 
+  static Values sccdagAbsorbsRemovedDependences(ModulePass &pass,
+                                                TestSuite &suite);
+  static Values removeDependencesAndCompare(PDG *dg, std::string const &name);
+  static Values compareSCCDAGs(SCCDAG &updatedSCCDAG,
+                               SCCDAG &freshSCCDAG,
+                               std::string const &round);
+
   static Values printSCCs(ModulePass &pass,
                           TestSuite &suite,
                           std::set<SCC *> sccs);
@@ -56,7 +56,8 @@ const char *SCCDAGAttrTestSuite::tests[] = {
   "reducible SCC",
   "clonable SCC",
   "clonable SCC into local memory",
-  "loop carried dependencies (top loop)"
+  "loop carried dependencies (top loop)",
+  "sccdag absorbs removed dependences"
 };
 TestFunction SCCDAGAttrTestSuite::testFns[] = {
   SCCDAGAttrTestSuite::sccdagHasCorrectSCCs,
@@ -64,7 +65,8 @@ TestFunction SCCDAGAttrTestSuite::testFns[] = {
   SCCDAGAttrTestSuite::reducibleSCCsAreFound,
   SCCDAGAttrTestSuite::clonableSCCsAreFound,
   SCCDAGAttrTestSuite::clonableSCCsIntoLocalMemoryAreFound,
-  SCCDAGAttrTestSuite::loopCarriedDependencies
+  SCCDAGAttrTestSuite::loopCarriedDependencies,
+  SCCDAGAttrTestSuite::sccdagAbsorbsRemovedDependences
 };
 
 bool SCCDAGAttrTestSuite::doInitialization(Module &M) {
@@ -355,4 +357,152 @@ Values SCCDAGAttrTestSuite::loopCarriedDependencies(ModulePass &pass,
   return valueNames;
 }
 
+Values SCCDAGAttrTestSuite::sccdagAbsorbsRemovedDependences(
+    ModulePass &pass,
+    TestSuite &suite) {
+  auto &attrPass = static_cast<SCCDAGAttrTestSuite &>(pass);
+
+  /*
+   * Removing dependences modifies the graph the SCCDAG has been computed from,
+   * so the test works on copies.
+   * The first copy is the one the SCCDAG of the loop is built from; the second
+   * one includes the whole function.
+   */
+  Values errors{};
+  for (auto includeFunction : { false, true }) {
+    auto dg = includeFunction ? attrPass.fdg->clone(false)
+                              : attrPass.ldi->getLoopDG()->clone(false);
+    auto name = includeFunction ? "function" : "loop";
+    errors = SCCDAGAttrTestSuite::removeDependencesAndCompare(dg, name);
+    delete dg;
+    if (errors.size() > 0) {
+      break;
+    }
+  }
+
+  return errors;
+}
+
+Values SCCDAGAttrTestSuite::removeDependencesAndCompare(
+    PDG *dg,
+    std::string const &name) {
+
+  /*
+   * Remove the dependences in rounds, from a sparse selection to all of them,
+   * and compare the updated SCCDAG with one computed from scratch after every
+   * round.
+   */
+  auto updatedSCCDAG = new SCCDAG(dg);
+  Values errors{};
+  for (auto stride : { 7u, 3u, 2u, 1u }) {
+    std::unordered_set<DGEdge<Value, Value> *> toRemove;
+    auto deps = dg->getSortedDependences();
+    for (auto i = 0u; i < deps.size(); i += stride) {
+      toRemove.insert(deps[i]);
+    }
+    updatedSCCDAG->removeDependences(dg, toRemove);
+
+    auto freshSCCDAG = new SCCDAG(dg);
+    auto round = name + ", removing 1 dependence every "
+                 + std::to_string(stride) + ": ";
+    errors = SCCDAGAttrTestSuite::compareSCCDAGs(*updatedSCCDAG,
+                                                 *freshSCCDAG,
+                                                 round);
+    delete freshSCCDAG;
+    if (errors.size() > 0) {
+      break;
+    }
+  }
+  delete updatedSCCDAG;
+
+  return errors;
+}
+
+Values SCCDAGAttrTestSuite::compareSCCDAGs(SCCDAG &updatedSCCDAG,
+                                           SCCDAG &freshSCCDAG,
+                                           std::string const &round) {
+  using SCCValues = std::set<Value *>;
+  using SubEdges = std::set<DGEdge<Value, Value> *>;
+
+  /*
+   * Identify SCCs by the values they contain.
+   */
+  auto getValues = [](SCC *scc) -> SCCValues {
+    SCCValues values;
+    for (auto nodePair : scc->internalNodePairs()) {
+      values.insert(nodePair.first);
+    }
+    return values;
+  };
+  auto getSCCs = [&getValues](SCCDAG &sccdag) {
+    std::map<SCCValues, SCC *> sccs;
+    for (auto node : sccdag.getNodes()) {
+      sccs[getValues(node->getT())] = node->getT();
+    }
+    return sccs;
+  };
+  auto getEdges = [&getValues](SCCDAG &sccdag) {
+    std::map<std::pair<SCCValues, SCCValues>, SubEdges> edges;
+    for (auto edge : sccdag.getEdges()) {
+      auto &subEdges = edges[std::make_pair(getValues(edge->getSrc()),
+                                            getValues(edge->getDst()))];
+      for (auto subEdge : edge->getSubEdges()) {
+        subEdges.insert(subEdge);
+      }
+    }
+    return edges;
+  };
+
+  /*
+   * Compare the SCCs.
+   */
+  auto updatedSCCs = getSCCs(updatedSCCDAG);
+  auto freshSCCs = getSCCs(freshSCCDAG);
+  if (updatedSCCs.size() != updatedSCCDAG.numNodes()) {
+    return { round + "the updated SCCDAG has SCCs with the same values" };
+  }
+  for (auto &pair : freshSCCs) {
+    if (updatedSCCs.find(pair.first) == updatedSCCs.end()) {
+      return { round + "an SCC is missing from the updated SCCDAG" };
+    }
+  }
+  if (updatedSCCs.size() != freshSCCs.size()) {
+    return { round + "the updated SCCDAG has extra SCCs" };
+  }
+
+  /*
+   * Compare the dependences between SCCs and their sub-edges.
+   */
+  auto updatedEdges = getEdges(updatedSCCDAG);
+  auto freshEdges = getEdges(freshSCCDAG);
+  if (updatedEdges.size() != freshEdges.size()) {
+    return { round + "the SCCDAGs have different dependences between SCCs" };
+  }
+  for (auto &pair : freshEdges) {
+    auto it = updatedEdges.find(pair.first);
+    if (it == updatedEdges.end()) {
+      return { round + "a dependence between SCCs is missing" };
+    }
+    if (it->second != pair.second) {
+      return { round + "a dependence between SCCs has different sub-edges" };
+    }
+  }
+
+  /*
+   * Compare the order among SCCs.
+   */
+  for (auto &early : freshSCCs) {
+    for (auto &late : freshSCCs) {
+      auto updatedOrder = updatedSCCDAG.orderedBefore(updatedSCCs[early.first],
+                                                      updatedSCCs[late.first]);
+      auto freshOrder = freshSCCDAG.orderedBefore(early.second, late.second);
+      if (updatedOrder != freshOrder) {
+        return { round + "the SCCDAGs order two SCCs differently" };
+      }
+    }
+  }
+
+  return {};
+}
+
 } // namespace arcana::noelle